@@ -61,4 +61,76 @@ uint16_t computeChecksum(const uint8_t *data, size_t length) {
   return (sum2 << 8) | sum1;
 }
 
+// Fixed size ring of typed records. Every push advances a sequence number so clients
+// can request only the records added since the last sequence number they received.
+// One slot is reserved for the record push() may be writing on another task, so a ring
+// of capacity slots serves the latest capacity - 1 records (capacity must be at least 2).
+// The uint32_t sequence restarts at 0 after 2^32 pushes, clients see that like a reboot
+// and refetch from the oldest record.
+class AsyncBufferRing {
+  public:
+    AsyncBufferType type;
+    uint8_t *data;
+    size_t recordSize;
+    size_t capacity;
+
+    AsyncBufferRing(AsyncBufferType type, uint8_t *data, size_t recordSize, size_t capacity)
+      : type(type), data(data), recordSize(recordSize), capacity(capacity) {};
+
+    // Copies one record into the ring, overwriting the oldest record once full.
+    void push(const uint8_t *record) {
+      memcpy(data + (_seq % capacity) * recordSize, record, recordSize);
+      __sync_synchronize(); // record must be written before it is published
+      _seq++;
+    }
+
+    // Sequence number the next pushed record will get.
+    uint32_t seq() {
+      return _seq;
+    }
+
+    // Sequence number of the oldest readable record when the ring is at seq, the
+    // record before it shares the slot the next push writes.
+    uint32_t oldest(uint32_t seq) {
+      return seq > capacity - 1 ? seq - (capacity - 1) : 0;
+    }
+
+    // First sequence number to send for a client cursor. Cursors that fell behind
+    // or are ahead of seq (device rebooted) restart from the oldest readable record.
+    uint32_t start(uint32_t since, uint32_t seq) {
+      uint32_t first = oldest(seq);
+      if(since < first || since > seq) {
+        return first;
+      }
+      return since;
+    }
+
+    size_t length(uint32_t start, uint32_t end) {
+      return (end - start) * recordSize;
+    }
+
+    // Copies records [start, end) oldest first into out, unwrapping the ring.
+    // Pushes that complete on another task during the copy overwrite the oldest records,
+    // those are dropped from the front of out. Returns the sequence number of the first
+    // record kept, out then holds length(returned, end) bytes.
+    uint32_t copy(uint32_t start, uint32_t end, uint8_t *out) {
+      uint8_t *o = out;
+      for(uint32_t s = start; s < end; s++) {
+        memcpy(o, data + (s % capacity) * recordSize, recordSize);
+        o += recordSize;
+      }
+      __sync_synchronize();
+      uint32_t first = oldest(_seq);
+      if(first > start) {
+        uint32_t kept = first < end ? first : end;
+        memmove(out, out + length(start, kept), length(kept, end));
+        start = kept;
+      }
+      return start;
+    }
+
+  private:
+    volatile uint32_t _seq = 0;
+};
+
 #endif
\ No newline at end of file
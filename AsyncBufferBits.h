@@ -0,0 +1,36 @@
+// AsyncBufferBits.h
+#ifndef AsyncBufferBits_H
+#define AsyncBufferBits_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Packed bool array, stores 8 flags per byte instead of one bool per byte.
+// Struct members declared as AsyncBufferBits<N> are decoded by the client as a bool array of length N.
+template <size_t N>
+struct AsyncBufferBits {
+  uint8_t bytes[(N + 7) / 8];
+
+  bool get(size_t index) const {
+    return (bytes[index >> 3] >> (index & 7)) & 1;
+  }
+
+  void set(size_t index, bool value) {
+    if(value) {
+      bytes[index >> 3] |= (1 << (index & 7));
+    }
+    else {
+      bytes[index >> 3] &= ~(1 << (index & 7));
+    }
+  }
+
+  bool operator[](size_t index) const {
+    return get(index);
+  }
+
+  size_t size() const {
+    return N;
+  }
+};
+
+#endif
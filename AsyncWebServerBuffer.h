@@ -74,6 +74,63 @@ class AsyncWebServerBuffer : public AsyncWebServer
       return AsyncWebServerBufferStatus::SUCCESS;
     }
 
+    // Sends the ring records newer than the "since" query parameter, oldest first.
+    // X-Seq-Start is the sequence number of the first record sent and X-Seq the next
+    // sequence number to request, X-Seq-Start greater than since means records were missed.
+    AsyncWebServerBufferStatus 
+    sendResponseRing(
+      AsyncWebServerRequest *request, 
+      AsyncBufferRing *ring
+    ) {
+      if (request->hasHeader("X-Type"))
+      { // optional but good for sanity checking in the client.
+        String requestType = request->getHeader("X-Type")->value();
+        
+        if (ring->type != getAsyncTypeFromName(requestType))
+        {
+          String typeStr = getAsyncTypeName(ring->type);
+          request->send(400, "text/plain", "Expected X-Type header to be " + typeStr);
+          return AsyncWebServerBufferStatus::TYPE_HEADER_MISMATCH;
+        }
+      }
+      uint32_t since = 0;
+      if (request->hasParam("since"))
+      {
+        since = strtoul(request->getParam("since")->value().c_str(), nullptr, 10);
+      }
+      uint32_t seq = ring->seq();
+      uint32_t start = ring->start(since, seq);
+      // copy the records out so the response isn't affected by pushes once the copy is done,
+      // records overwritten during the copy are dropped and start is moved past them
+      auto buffer = std::make_shared<std::vector<uint8_t>>(ring->length(start, seq), 0);
+      start = ring->copy(start, seq, buffer->data());
+      buffer->resize(ring->length(start, seq));
+
+      AsyncWebServerResponse *response;
+      if (buffer->empty())
+      {
+        response = request->beginResponse(200, "application/octet-stream", "");
+      }
+      else
+      {
+        response = request->beginResponse("application/octet-stream", buffer->size(), [buffer](uint8_t *out, size_t maxLen, size_t index) -> size_t {
+          size_t len = std::min(maxLen, buffer->size() - index);
+          memcpy(out, buffer->data() + index, len);
+          return len;
+        });
+      }
+      if (request->hasHeader("X-Checksum") && _ASYNC_BUFFER_USE_CHECKSUM == true)
+      {
+        String checksum = String(::computeChecksum(buffer->data(), buffer->size()));
+        response->addHeader("X-Checksum", checksum);
+      }
+      response->addHeader("X-Type", ring->type);
+      response->addHeader("X-Seq-Start", String(start));
+      response->addHeader("X-Seq", String(seq));
+      request->send(response);
+      return AsyncWebServerBufferStatus::SUCCESS;
+    }
+
     AsyncWebServerBufferStatus 
     processRequestBuffer(
       AsyncWebServerRequest *request, 
@@ -254,6 +311,30 @@ class AsyncWebServerBuffer : public AsyncWebServer
       onBuffer(uri, method, t, data, size, callback, handleResponse);
     }
 
+    // Creates a GET route at the URI path returning the ring records added since the "since" query parameter.
+    void onBufferRing(
+        const char *uri,
+        AsyncBufferRing *ring,
+        std::function<bool(AsyncWebServerRequest *)> callback = nullptr)
+    {
+      on(uri, HTTP_GET, [this, ring, callback](AsyncWebServerRequest *request)
+      {
+        bool sendResponse = true;
+        if (callback)
+        {
+          sendResponse = callback(request);
+        }
+        if (sendResponse)
+        {
+          sendResponseRing(request, ring);
+        }
+        else
+        {
+          request->send(200, "text/plain", "SUCCESS!");
+        }
+      });
+    }
+
     void disableCORS() {
       static bool _disabledCORS = false;
       if (_disabledCORS)
@@ -55,6 +55,25 @@ class AsyncWebSocketClientBuffer : public AsyncWebSocketClient
     bool sendBuffer(String command, AsyncBufferType type, uint8_t *data, size_t len) {
       return binary(makeSocketPayloadBuffer(command, type, data, len));
     };
+
+    // Sends the ring records newer than since, the body starts with the uint32_t
+    // sequence number of the first record sent and the next sequence number to request.
+    bool sendBufferRing(String command, AsyncBufferRing *ring, uint32_t since) {
+      uint32_t seq = ring->seq();
+      uint32_t start = ring->start(since, seq);
+      String header = command + ";" + String((int)ring->type) + ";";
+      size_t headerLen = header.length();
+      size_t recordsOffset = headerLen + sizeof(start) + sizeof(seq);
+      auto buffer = std::make_shared<std::vector<uint8_t>>(recordsOffset + ring->length(start, seq), 0);
+      uint8_t *body = buffer->data();
+      memcpy(body, header.c_str(), headerLen);
+      // records overwritten during the copy are dropped and start is moved past them
+      start = ring->copy(start, seq, body + recordsOffset);
+      memcpy(body + headerLen, &start, sizeof(start));
+      memcpy(body + headerLen + sizeof(start), &seq, sizeof(seq));
+      buffer->resize(recordsOffset + ring->length(start, seq));
+      return binary(buffer);
+    }
 };
 
 class AsyncWebSocketBuffer : public AsyncWebSocket
@@ -136,6 +155,29 @@ class AsyncWebSocketBuffer : public AsyncWebSocket
       _commands.emplace_back(c);
     }
 
+    // register a ring listener, clients send the uint32_t sequence number to fetch from
+    void onBufferRing(
+      String command,
+      AsyncBufferRing *ring,
+      AsyncWebSocketBufferCallback callback = nullptr
+    ) {
+      // no buffer but a fixed length so payloads other than one uint32_t are rejected
+      onBuffer(command, AsyncBufferType::UINT32_T, nullptr, sizeof(uint32_t), [ring, callback](AsyncWebSocketClientBuffer *client, String command, AsyncBufferType type, uint8_t *data, size_t len, AsyncWebSocketBufferStatus status) {
+        if(status != AsyncWebSocketBufferStatus::GET && status != AsyncWebSocketBufferStatus::SET) {
+          return false; // error already sent
+        }
+        if(callback != nullptr && !callback(client, command, type, data, len, status)) {
+          return false;
+        }
+        uint32_t since = 0;
+        if(status == AsyncWebSocketBufferStatus::SET) {
+          memcpy(&since, data, sizeof(since));
+        }
+        client->sendBufferRing(command, ring, since);
+        return false; // already responded
+      });
+    }
+
   private:
     void _onBufferEvent(AsyncWebSocket* wsServer, AsyncWebSocketClientBuffer* client, AwsEventType type, void* arg, uint8_t* data, size_t len) {
       if (type == WS_EVT_CONNECT) {
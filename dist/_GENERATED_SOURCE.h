@@ -49,9 +49,9 @@ enum AsyncBufferType {
 #include "AsyncBuffer.h"
 const char FILE_MODELS_JS_URL[] PROGMEM = "/js/models.js";
 const char FILE_MODELS_JS_CONTENT_TYPE[] PROGMEM = "application/javascript";
-const char FILE_MODELS_JS_ETAG[] PROGMEM = "39603";
+const char FILE_MODELS_JS_ETAG[] PROGMEM = "82325";
 const bool FILE_MODELS_JS_GZIP = true;
-const uint8_t FILE_MODELS_JS_BODY[] PROGMEM = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xc5, 0x59, 0x6d, 0x8f, 0xdb, 0x36, 0x12, 0xfe, 0x2b, 0xb2, 0x9c, 0xba, 0x64, 0xcd, 0x2a, 0xde, 0xa4, 0x09, 0x02, 0x69, 0xb9, 0x46, 0x9a, 0x6c, 0x0f, 0x01, 0xfa, 0x06, 0x24, 0xbd, 0x3b, 0xc0, 0x30, 0x62, 0xae, 0x35, 0xb6, 0xd9, 0x68, 0x49, 0x1f, 0x39, 0x8a, 0xb3, 0xe7, 0xd5, 0x7f, 0x3f, 0x90, 0x94, 0x64, 0xc9, 0xf6, 0x2e, 0xd2, 0x7e, 0xb9, 0x2f, 0x89, 0x56, 0x1c, 0xce, 0x0c, 0x67, 0x9e, 0x79, 0x66, 0x28, 0xc7, 0xa5, 0x85, 0xc8, 0xa2, 0x91, 0x4b, 0x8c, 0xb3, 0xa5, 0x56, 0x16, 0xa3, 0x8f, 0x16, 0x4d, 0xb9, 0x44, 0xcb, 0xf7, 0x55, 0xb6, 0x2c, 0x84, 0xb5, 0xd1, 0x6b, 0x7b, 0xa7, 0x96, 0x3f, 0x96, 0xab, 0x15, 0x98, 0xd7, 0xbf, 0xbf, 0xdb, 0x0f, 0x81, 0xc7, 0xff, 0xfe, 0xfe, 0xc3, 0xdd, 0x16, 0xe2, 0x6c, 0x88, 0xee, 0xf9, 0xcd, 0x06, 0x96, 0x9f, 0x6c, 0x79, 0x1b, 0x67, 0x43, 0xcb, 0x27, 0xd9, 0x50, 0xf1, 0xfd, 0x8d, 0xd6, 0x45, 0xba, 0xb7, 0xe9, 0x05, 0xbb, 0x4d, 0xe3, 0x3f, 0xa4, 0xc2, 0x98, 0x6d, 0xd3, 0xc1, 0xa4, 0x62, 0xcb, 0x8d, 0x30, 0xed, 0xc2, 0xbb, 0xc3, 0xfb, 0xb8, 0x54, 0x56, 0xae, 0x15, 0xe4, 0x91, 0x93, 0x88, 0xcf, 0xee, 0x95, 0x0a, 0x5f, 0x7d, 0xc4, 0x73, 0xbb, 0xcb, 0xa3, 0xa5, 0xee, 0x2e, 0xbb, 0xd1, 0xc6, 0xaf, 0x3c, 0x7b, 0xd0, 0xa4, 0x17, 0x89, 0x5b, 0x99, 0x23, 0x9b, 0x17, 0x2f, 0x3f, 0x9e, 0xdd, 0x5f, 0x1e, 0xaf, 0x1d, 0xed, 0x73, 0xef, 0x7f, 0x78, 0xd0, 0xa6, 0x93, 0x6d, 0x25, 0xba, 0x3b, 0x0b, 0xad, 0xd6, 0x8f, 0x6f, 0x75, 0x12, 0xe7, 0xf7, 0x4a, 0x85, 0xcf, 0x9f, 0x7d, 0x3c, 0x6b, 0xb9, 0x3c, 0x5e, 0xeb, 0xc5, 0x48, 0xfe, 0x17, 0xce, 0x6f, 0x5b, 0x15, 0x5a, 0x1c, 0x16, 0x7e, 0x72, 0x7f, 0x35, 0x4b, 0xb9, 0x2e, 0x6f, 0x0a, 0x70, 0x6b, 0xaf, 0x4e, 0xd6, 0x62, 0xe7, 0xe3, 0xc1, 0x51, 0x2f, 0xf0, 0xa3, 0x5c, 0x3f, 0x78, 0x9c, 0x53, 0xd1, 0xa3, 0x63, 0xbd, 0xfc, 0x21, 0xf8, 0x77, 0x46, 0x53, 0x79, 0x66, 0xb9, 0xb3, 0xbb, 0xca, 0x86, 0x92, 0x2b, 0xd8, 0x45, 0xbf, 0x88, 0x6d, 0x36, 0x34, 0xed, 0xa3, 0x87, 0xbb, 0x83, 0xba, 0x36, 0x04, 0xf8, 0xbe, 0xa2, 0x7b, 0xdc, 0x48, 0x9b, 0x2c, 0xb5, 0x5a, 0xc9, 0x35, 0xdf, 0x6f, 0xb4, 0xc5, 0x34, 0xd6, 0x37, 0x7f, 0xc2, 0x12, 0x63, 0xce, 0xf1, 0x6e, 0x0b, 0x7a, 0x15, 0x15, 0x7a, 0x29, 0x50, 0x6a, 0x35, 0x6d, 0x1e, 0x92, 0x20, 0x17, 0xb3, 0x1b, 0x61, 0xe1, 0x0f, 0x53, 0xb8, 0xc7, 0x9d, 0xf5, 0x0f, 0x4f, 0x77, 0x36, 0x66, 0xa5, 0x85, 0xa6, 0x3c, 0xd2, 0xc1, 0x84, 0x81, 0x12, 0x37, 0x05, 0xbc, 0x85, 0x9b, 0x72, 0x9d, 0x0e, 0x2e, 0x58, 0x92, 0x24, 0x50, 0x31, 0x6f, 0x57, 0xe4, 0xb9, 0xab, 0x29, 0xe2, 0xff, 0x18, 0x2a, 0xda, 0x7f, 0xdb, 0x54, 0x25, 0xad, 0x84, 0xab, 0xc6, 0x68, 0x05, 0xb8, 0xdc, 0x10, 0xe0, 0xf1, 0x3f, 0xae, 0x3f, 0xc4, 0x0c, 0x99, 0xe5, 0xaa, 0x2c, 0x0a, 0xa6, 0xc2, 0x7f, 0xd2, 0x1f, 0x27, 0xd4, 0xb3, 0xe1, 0xfb, 0x5b, 0xc0, 0x8d, 0xce, 0x53, 0x60, 0x1b, 0x10, 0x39, 0x18, 0x9b, 0xee, 0x2b, 0x67, 0x59, 0x56, 0x99, 0x93, 0x1e, 0x70, 0x6e, 0x47, 0x23, 0x62, 0xb9, 0x37, 0xb8, 0x06, 0xf4, 0x06, 0x2d, 0x65, 0x26, 0xa9, 0xe5, 0x67, 0xc1, 0x27, 0x98, 0x73, 0x9b, 0xc8, 0x9c, 0x32, 0x6f, 0x74, 0xc0, 0x61, 0x4a, 0x4c, 0x72, 0xa3, 0xf3, 0xbb, 0xb0, 0x13, 0xd4, 0x52, 0xe7, 0x40, 0xec, 0x34, 0x91, 0xf9, 0xfd, 0x7d, 0x70, 0xe7, 0xfe, 0x7e, 0xe2, 0xf4, 0x38, 0xa1, 0xb7, 0xe0, 0x96, 0x73, 0xae, 0x3a, 0x7a, 0xe3, 0x37, 0x5a, 0x21, 0x28, 0x0c, 0x6c, 0x32, 0xe7, 0x31, 0xc2, 0x17, 0x7c, 0xba, 0x2d, 0x84, 0x54, 0x31, 0xeb, 0x64, 0x23, 0xe9, 0x44, 0x71, 0x34, 0x22, 0xc7, 0x8e, 0xe1, 0x3c, 0x78, 0x30, 0xd4, 0xc4, 0x25, 0xd7, 0xe5, 0xfe, 0xd5, 0x6b, 0x63, 0xc4, 0x5d, 0xed, 0x1f, 0xa5, 0x09, 0xea, 0xf7, 0x68, 0xa4, 0x5a, 0x13, 0x4a, 0x69, 0xfa, 0x97, 0x34, 0xc7, 0x31, 0xcd, 0x0a, 0xc0, 0x48, 0xfb, 0xd0, 0xd6, 0x24, 0x29, 0xb8, 0xd8, 0x09, 0x89, 0x75, 0x1a, 0x16, 0x4f, 0xba, 0xd0, 0x49, 0x6a, 0x24, 0x54, 0x4f, 0xf6, 0x58, 0x2d, 0x98, 0xa1, 0x99, 0x5c, 0x11, 0x91, 0x84, 0x24, 0x70, 0x60, 0x22, 0x31, 0xf0, 0x9f, 0x12, 0x2c, 0x76, 0x12, 0x53, 0x9a, 0x22, 0x45, 0xe6, 0x30, 0x96, 0xda, 0x69, 0xa2, 0xc4, 0x2d, 0xd4, 0x11, 0xcc, 0x05, 0x8a, 0x54, 0x31, 0xbd, 0x75, 0x58, 0xb3, 0xa9, 0xac, 0xd8, 0x40, 0x24, 0xfa, 0x13, 0x35, 0x80, 0xa5, 0x51, 0x91, 0xae, 0xfd, 0x10, 0x89, 0x8b, 0x1c, 0xa1, 0x6c, 0xa6, 0x99, 0x60, 0x3d, 0x15, 0x73, 0x67, 0x3e, 0x16, 0xdb, 0x6d, 0x21, 0x03, 0x62, 0x9f, 0xea, 0x25, 0x02, 0x7e, 0x6f, 0xd1, 0x80, 0xb8, 0x8d, 0x39, 0xe7, 0xa2, 0x39, 0xb4, 0x4b, 0x3e, 0xe9, 0xe7, 0x84, 0x8e, 0x46, 0x87, 0xe5, 0x8d, 0xb0, 0x35, 0x3c, 0x81, 0x36, 0xf0, 0x82, 0xd6, 0x03, 0xe1, 0x22, 0x1e, 0xda, 0x04, 0xa9, 0xcf, 0x7c, 0xba, 0x11, 0xdb, 0x8d, 0xf8, 0x50, 0xce, 0xa0, 0x97, 0x2e, 0x66, 0x8f, 0xfc, 0x6b, 0xf4, 0x38, 0x0b, 0x0f, 0x26, 0xd2, 0x0e, 0x38, 0x52, 0xdc, 0x18, 0xbd, 0x8b, 0x9c, 0xf6, 0x6b, 0x63, 0xb4, 0x21, 0x71, 0xb3, 0x1e, 0xad, 0x84, 0x2c, 0x20, 0x1f, 0xc4, 0xb4, 0x3a, 0x42, 0xfd, 0x39, 0x53, 0x40, 0x29, 0xd3, 0x41, 0x2c, 0x87, 0x00, 0xf1, 0x44, 0xe6, 0x0c, 0x68, 0x05, 0x85, 0x85, 0x93, 0x14, 0x64, 0x75, 0x6a, 0x44, 0x0f, 0xf5, 0xba, 0x07, 0xe7, 0x0e, 0x0b, 0x8c, 0x46, 0x2e, 0x1c, 0xba, 0x80, 0xa4, 0xd0, 0x6b, 0x87, 0x24, 0x53, 0x23, 0xa5, 0x4a, 0xa3, 0xc7, 0x60, 0x25, 0xce, 0xe6, 0xba, 0x66, 0x07, 0xe7, 0x3c, 0x30, 0x0c, 0x64, 0x60, 0x3d, 0x19, 0x34, 0x5e, 0x79, 0x5f, 0xbd, 0xda, 0x80, 0xdd, 0x40, 0x20, 0xc0, 0x90, 0x05, 0xe1, 0x86, 0x60, 0xb6, 0xa5, 0x57, 0x71, 0x20, 0x96, 0x47, 0x95, 0xfc, 0xfe, 0x47, 0xad, 0xc4, 0x32, 0xd5, 0x6a, 0xd0, 0xf6, 0x2f, 0xa9, 0xf8, 0xed, 0xfd, 0xa9, 0x8e, 0x1c, 0x0a, 0x40, 0xf8, 0x0b, 0x5a, 0xde, 0x5e, 0xff, 0x7c, 0xfd, 0xe1, 0xba, 0xa3, 0x67, 0x17, 0xf6, 0x65, 0x43, 0xd1, 0x12, 0xbf, 0x56, 0x4e, 0x61, 0x4d, 0xf7, 0x43, 0x91, 0xd8, 0x10, 0x2d, 0x5a, 0x59, 0x50, 0x79, 0x37, 0x6e, 0xb5, 0xc1, 0xe7, 0x74, 0xdf, 0x60, 0x4d, 0x6f, 0x41, 0x11, 0xca, 0x2e, 0x06, 0x9c, 0x8b, 0xad, 0x4c, 0x76, 0x36, 0x31, 0x20, 0xf2, 0xbb, 0xf7, 0x28, 0x10, 0x46, 0x23, 0xd5, 0x94, 0xe5, 0x67, 0x2d, 0xf3, 0xc8, 0x02, 0x7e, 0x90, 0xb7, 0xa0, 0x4b, 0x24, 0x84, 0x50, 0x7e, 0xe5, 0x15, 0x34, 0x26, 0x9c, 0x73, 0xdf, 0x5f, 0x50, 0xca, 0x2e, 0x26, 0x13, 0x5a, 0x93, 0x4a, 0xe8, 0x52, 0x1f, 0xe0, 0x0b, 0x5e, 0x7b, 0x2a, 0x35, 0x9e, 0x77, 0x0c, 0x5f, 0x3c, 0xd9, 0x43, 0x95, 0x2d, 0x98, 0xe6, 0x47, 0x95, 0x32, 0xa1, 0x4c, 0x84, 0xd3, 0xd5, 0x3c, 0x8e, 0xa3, 0x51, 0xc3, 0xe8, 0x53, 0x22, 0xfa, 0xd0, 0x46, 0xca, 0xcc, 0xd8, 0xe9, 0x12, 0x89, 0xcc, 0xcf, 0xaa, 0xeb, 0xb2, 0x38, 0x32, 0xeb, 0x98, 0xd2, 0x8c, 0x79, 0x9c, 0xc5, 0xcc, 0x70, 0xd9, 0x2c, 0x98, 0xc0, 0x86, 0x9b, 0xe3, 0xcd, 0x26, 0x29, 0x40, 0xad, 0x71, 0x33, 0xd6, 0xf5, 0x03, 0xcd, 0x36, 0x3e, 0xb2, 0x86, 0x4d, 0x28, 0x0b, 0x8f, 0x9a, 0x35, 0x52, 0x75, 0x77, 0xdb, 0xd5, 0x01, 0xd9, 0x24, 0x37, 0x9e, 0x37, 0xe8, 0x57, 0x56, 0xc9, 0xce, 0x46, 0x6e, 0x9f, 0xab, 0x10, 0xa8, 0xa2, 0x27, 0x7b, 0x31, 0x5d, 0x5c, 0xba, 0x83, 0xb9, 0x4a, 0xa8, 0xae, 0x16, 0x69, 0x1c, 0x57, 0x0b, 0x07, 0xe5, 0x65, 0xa1, 0x2d, 0x90, 0x3a, 0xd3, 0x3b, 0x3b, 0x1a, 0x3d, 0x77, 0x41, 0xaa, 0x2d, 0x77, 0x33, 0x47, 0x9a, 0x97, 0xf5, 0x8e, 0xc6, 0x3d, 0x1f, 0x5d, 0x5a, 0x85, 0xb4, 0xf7, 0xd4, 0x9c, 0x6a, 0xb9, 0xbf, 0x27, 0xed, 0x2e, 0xd8, 0x45, 0xff, 0x82, 0x9b, 0xf7, 0x7a, 0xf9, 0x09, 0xd0, 0xb9, 0x9b, 0x3e, 0x7d, 0xda, 0x2f, 0x66, 0x37, 0x35, 0x54, 0xfd, 0x57, 0x7e, 0x6a, 0xa8, 0x16, 0x87, 0xd0, 0x88, 0x3c, 0xbf, 0xfe, 0x0c, 0x0a, 0x7f, 0x96, 0x16, 0x41, 0x81, 0x21, 0xb1, 0xf3, 0x23, 0x66, 0x04, 0xf8, 0xd5, 0x11, 0x89, 0x8a, 0x40, 0xdd, 0x7e, 0x9d, 0x66, 0x38, 0x1a, 0x21, 0x81, 0xaf, 0x0c, 0x66, 0xbc, 0xb3, 0x91, 0xdb, 0x07, 0x79, 0x1a, 0x3b, 0x52, 0xa3, 0x8f, 0x39, 0x00, 0x8e, 0x48, 0x1f, 0xf3, 0x20, 0x08, 0xfc, 0x0d, 0x17, 0xfc, 0xc6, 0xaf, 0xf0, 0xc0, 0x27, 0xe8, 0x31, 0x0f, 0x82, 0xc0, 0xdf, 0xf0, 0xc0, 0x6f, 0x0c, 0x41, 0xe8, 0xa5, 0xff, 0x71, 0x7f, 0x6e, 0xc1, 0x5a, 0xb1, 0x76, 0x1e, 0x05, 0xc6, 0x72, 0x7e, 0xb9, 0x02, 0x39, 0x26, 0x11, 0x5f, 0xa6, 0x72, 0x45, 0x20, 0x71, 0x2d, 0x3d, 0x92, 0xca, 0xa2, 0x50, 0x4b, 0x37, 0x52, 0xfe, 0x58, 0xe8, 0x9b, 0xa6, 0x29, 0xca, 0xba, 0x99, 0x04, 0xa9, 0x7e, 0x4b, 0x65, 0xe6, 0xb8, 0xe6, 0xa4, 0x6f, 0x82, 0x26, 0xb9, 0xb9, 0x43, 0xf8, 0xd9, 0xd7, 0xd5, 0x25, 0x7f, 0x56, 0x73, 0x50, 0x3d, 0xb3, 0x4c, 0x98, 0xe0, 0xb3, 0x38, 0x66, 0x71, 0x3c, 0xcf, 0x56, 0xda, 0x10, 0xf7, 0x16, 0xf8, 0x24, 0x83, 0xcb, 0xee, 0xb6, 0x0c, 0xc6, 0x63, 0x5a, 0xbb, 0x1d, 0x1a, 0x6f, 0xb2, 0x32, 0xfa, 0xf6, 0xcd, 0x46, 0x98, 0x37, 0xbe, 0xe8, 0x67, 0x30, 0xf7, 0xb6, 0x9e, 0x71, 0xae, 0xe9, 0x8d, 0x01, 0xf1, 0x29, 0x8b, 0xb3, 0x78, 0xc0, 0x71, 0x2a, 0x66, 0x7a, 0x3e, 0xe6, 0x98, 0xea, 0xf1, 0xb8, 0x9a, 0x21, 0xb3, 0x73, 0x2e, 0x6a, 0x82, 0xc0, 0x86, 0x11, 0x6c, 0x4b, 0x0d, 0x99, 0xe2, 0x26, 0xb1, 0x85, 0x5c, 0x02, 0xd9, 0x50, 0xa6, 0x3c, 0x87, 0x36, 0x3d, 0x95, 0xa9, 0x96, 0x04, 0x4e, 0x46, 0xd1, 0x50, 0xd8, 0x4e, 0xad, 0xec, 0x27, 0xfb, 0xbb, 0x98, 0x66, 0x72, 0x34, 0x92, 0x0d, 0xa5, 0x52, 0xd6, 0x17, 0x40, 0xca, 0xfa, 0xcb, 0x5f, 0xcd, 0x2f, 0x06, 0x96, 0x20, 0x3f, 0x83, 0x6f, 0xc2, 0x55, 0x74, 0xf9, 0x64, 0x6f, 0xab, 0xab, 0x85, 0x6b, 0x28, 0x94, 0xd2, 0xaa, 0x99, 0xca, 0x7d, 0x1b, 0x69, 0x7a, 0xc3, 0x50, 0xfa, 0x39, 0x07, 0xe8, 0xc9, 0xe0, 0xb1, 0x70, 0xc2, 0x91, 0x28, 0x3c, 0x57, 0x44, 0x39, 0xac, 0xa4, 0xbb, 0xf6, 0x7c, 0xeb, 0xc8, 0xeb, 0xdb, 0x85, 0x8f, 0xeb, 0xc9, 0x3d, 0x03, 0x0e, 0x63, 0xd2, 0x6c, 0xde, 0x8c, 0x14, 0xbf, 0x79, 0xa1, 0xe4, 0x13, 0xdc, 0x39, 0x33, 0xc9, 0x4a, 0x9b, 0x6b, 0xb1, 0xdc, 0x10, 0x62, 0xf9, 0xd5, 0x1e, 0x93, 0x6d, 0x69, 0x37, 0xa4, 0x77, 0x69, 0xb0, 0x0c, 0x66, 0x76, 0x4e, 0x43, 0x45, 0xf9, 0xf0, 0x59, 0x8e, 0x7e, 0x6e, 0x4a, 0xec, 0x61, 0x7e, 0x7b, 0xf5, 0x1d, 0x26, 0x36, 0xb3, 0x7c, 0xef, 0x2e, 0x81, 0x29, 0x26, 0x96, 0x6d, 0x8d, 0xbc, 0x95, 0xe8, 0x4e, 0x8f, 0xc9, 0xb6, 0x62, 0x36, 0x69, 0x5f, 0xb8, 0x7b, 0x82, 0xa7, 0xbc, 0x5f, 0xc2, 0x34, 0xbb, 0x58, 0x03, 0x3e, 0xd9, 0x63, 0x72, 0x5b, 0xb9, 0xc3, 0x2c, 0x98, 0x4d, 0x76, 0x46, 0x22, 0x34, 0xab, 0xb6, 0xb7, 0x4a, 0xab, 0x60, 0x52, 0xf1, 0xbd, 0xcc, 0xc3, 0x10, 0x3e, 0xb4, 0xe3, 0x71, 0xc7, 0xdc, 0xe0, 0x82, 0xb9, 0x4c, 0xa7, 0xe0, 0xae, 0x27, 0xb6, 0x6a, 0xce, 0x1d, 0x44, 0x4d, 0xdd, 0xa8, 0x95, 0xbf, 0x83, 0x34, 0x21, 0x77, 0xef, 0xdc, 0x1b, 0x97, 0x5c, 0x55, 0xd5, 0x90, 0xb1, 0xa4, 0x1d, 0x11, 0x7c, 0xa5, 0x78, 0x34, 0x37, 0x59, 0x62, 0x84, 0xcc, 0x80, 0xe1, 0x9c, 0xf2, 0x2b, 0xb2, 0x3f, 0x98, 0x43, 0x9f, 0xd9, 0x06, 0x73, 0x6e, 0x0a, 0x18, 0x4c, 0x7c, 0x72, 0x63, 0xeb, 0x2b, 0xa2, 0x9b, 0x1b, 0xb9, 0x22, 0xd2, 0xfe, 0x2a, 0x7e, 0x75, 0xc9, 0x76, 0x22, 0x83, 0xc6, 0xc3, 0x1a, 0x00, 0x1e, 0x13, 0xa7, 0x30, 0xf0, 0xc3, 0xa0, 0x54, 0xeb, 0xa8, 0x54, 0x9f, 0x94, 0xde, 0xa9, 0xc8, 0x29, 0x8c, 0x82, 0xfa, 0x03, 0x1c, 0x6a, 0xc7, 0x3d, 0xf5, 0x00, 0x6f, 0x34, 0xfb, 0x91, 0xae, 0x1e, 0x39, 0x81, 0x6f, 0x85, 0xb1, 0xf0, 0x4e, 0xb9, 0x70, 0x5c, 0x4c, 0x1e, 0x40, 0xd0, 0x68, 0x04, 0xbe, 0x6e, 0x9a, 0xa1, 0x04, 0xb2, 0x83, 0xa7, 0xf2, 0x6f, 0x79, 0x2a, 0xf3, 0xf3, 0x5e, 0xf6, 0xd2, 0x24, 0x1b, 0x57, 0xd7, 0x80, 0xd7, 0xb7, 0x5b, 0xbc, 0x0b, 0xf1, 0x3c, 0x1a, 0xfb, 0xdb, 0x38, 0x87, 0x39, 0xfe, 0x80, 0xb0, 0x36, 0x71, 0x41, 0xdb, 0x86, 0x00, 0x9b, 0xd0, 0x06, 0xbb, 0xc9, 0x4a, 0x42, 0x91, 0x5b, 0x3f, 0x04, 0x7a, 0x3a, 0xf3, 0x3a, 0xf7, 0xfe, 0xde, 0x04, 0x01, 0x3a, 0xc8, 0x3e, 0x8b, 0xa2, 0x84, 0x54, 0x32, 0x4f, 0x9e, 0xef, 0x1d, 0xa6, 0x4d, 0xa5, 0x57, 0x51, 0x8b, 0x78, 0xcb, 0xfd, 0x78, 0x36, 0x19, 0x70, 0x2e, 0xa7, 0x32, 0x6d, 0xdc, 0xe9, 0xfa, 0x9a, 0xa9, 0x19, 0xce, 0xb9, 0x19, 0x8d, 0x62, 0xff, 0x31, 0xca, 0x5d, 0x75, 0x3b, 0x38, 0xda, 0x07, 0x3a, 0x4b, 0x4d, 0xc5, 0xfc, 0x60, 0x67, 0x29, 0x4d, 0x6d, 0x13, 0x04, 0x55, 0xd5, 0x84, 0xe6, 0xb9, 0xa1, 0xb1, 0x78, 0xe6, 0xcc, 0x03, 0xfb, 0xb5, 0x61, 0x6f, 0x63, 0xee, 0xa2, 0xa0, 0x1c, 0x1f, 0xc8, 0x15, 0xb1, 0xdd, 0x90, 0xc9, 0x15, 0x51, 0x7c, 0xd6, 0x8b, 0x43, 0xec, 0xc3, 0x10, 0x57, 0x73, 0x86, 0x1d, 0xa2, 0xbf, 0xb2, 0x89, 0xab, 0xf2, 0x90, 0xf6, 0xce, 0xfb, 0x6f, 0xc2, 0xfb, 0x01, 0x9f, 0x9c, 0xde, 0x9a, 0xde, 0xa9, 0xcf, 0xa2, 0x90, 0x79, 0xe4, 0xe3, 0x19, 0x05, 0x8e, 0x8e, 0x9c, 0x74, 0xb4, 0xd2, 0xc6, 0x7b, 0x98, 0xc4, 0x2e, 0x62, 0x93, 0x79, 0xd2, 0x86, 0x9c, 0x77, 0x95, 0x3f, 0x0d, 0xca, 0xab, 0x00, 0x5e, 0xc5, 0x6d, 0x9d, 0xc6, 0x2c, 0x10, 0xba, 0x33, 0xf5, 0x56, 0xa0, 0xf8, 0xa7, 0x84, 0x9d, 0x9f, 0x52, 0xf9, 0x84, 0x69, 0x97, 0xe0, 0x26, 0xa2, 0x07, 0xa2, 0x23, 0xbd, 0x23, 0xda, 0x4e, 0x8a, 0x55, 0x45, 0xdb, 0x81, 0x40, 0x9c, 0x0b, 0xb7, 0xa2, 0x7b, 0x3d, 0xb3, 0x73, 0x17, 0xbd, 0xa6, 0x0f, 0x0a, 0x3e, 0xc9, 0xc4, 0xa5, 0xca, 0xc4, 0x78, 0x4c, 0x4d, 0x5d, 0x68, 0x05, 0x41, 0x26, 0x99, 0x61, 0x9a, 0x01, 0xb3, 0x6c, 0x30, 0xa1, 0x59, 0x80, 0x80, 0xbf, 0x26, 0x3b, 0xab, 0xa3, 0x11, 0xf1, 0x7a, 0xdc, 0x3f, 0xc9, 0x9f, 0x5a, 0x2a, 0x12, 0xc7, 0xb4, 0xae, 0xcb, 0xb3, 0x4a, 0x3c, 0xfb, 0x76, 0xb2, 0x35, 0xd5, 0x49, 0x40, 0xa8, 0xae, 0x86, 0x45, 0xd3, 0x98, 0x82, 0x38, 0x1f, 0x5c, 0xd0, 0xf3, 0x67, 0x90, 0xf5, 0x85, 0xba, 0x93, 0xf3, 0xd0, 0xc9, 0x45, 0x87, 0x8d, 0xd9, 0x86, 0x37, 0x45, 0x23, 0x19, 0xce, 0x60, 0x4e, 0xfc, 0x09, 0x68, 0xa6, 0xa7, 0x6a, 0x66, 0xe6, 0xa1, 0x41, 0x6c, 0x68, 0xea, 0xfe, 0xe0, 0x1b, 0x66, 0xc7, 0x5c, 0x84, 0xc4, 0x38, 0xe7, 0xeb, 0xee, 0x0f, 0x75, 0x7b, 0xb6, 0xcc, 0x8e, 0x83, 0xb2, 0x25, 0x39, 0xf2, 0xa4, 0xce, 0x1e, 0xa5, 0x59, 0xcf, 0xd5, 0x1a, 0xf6, 0x92, 0x61, 0xdf, 0xa0, 0xa8, 0x0d, 0x0a, 0x67, 0xb0, 0x0b, 0x8b, 0xa6, 0x62, 0x6c, 0x55, 0x5f, 0x2d, 0x7c, 0xc5, 0x84, 0x4a, 0x9f, 0xcd, 0xb3, 0xa3, 0x1c, 0x76, 0x02, 0x48, 0xec, 0x83, 0x58, 0x0f, 0x55, 0x2a, 0x6d, 0x7d, 0xa1, 0xa1, 0xae, 0x5f, 0x1d, 0x03, 0xb3, 0xbd, 0x81, 0xf0, 0x7d, 0x48, 0x04, 0x56, 0x34, 0x3d, 0x29, 0xd1, 0x2e, 0x46, 0x95, 0xc7, 0xe8, 0xeb, 0xce, 0x30, 0xd6, 0x84, 0xc6, 0x52, 0x37, 0x71, 0xf4, 0x10, 0xac, 0x3c, 0x82, 0x1b, 0xf0, 0xda, 0xaf, 0x01, 0xaf, 0xf6, 0xe0, 0x95, 0x2b, 0xa2, 0x69, 0x1f, 0x9b, 0xba, 0x87, 0xcd, 0x9c, 0x04, 0x9c, 0x00, 0xc3, 0x99, 0x9d, 0xcf, 0xc4, 0xdc, 0xe3, 0xb3, 0x87, 0xbc, 0xbe, 0x88, 0x87, 0x9e, 0xaa, 0x86, 0xf9, 0x01, 0x66, 0x87, 0xaf, 0x82, 0xbd, 0xf3, 0xaa, 0x7a, 0x92, 0xec, 0xe0, 0x0b, 0x67, 0xa6, 0xdb, 0xcc, 0x1d, 0x98, 0x82, 0x8d, 0xd2, 0xd9, 0xa0, 0xce, 0xb6, 0xcb, 0xa8, 0x39, 0x81, 0x50, 0xf7, 0x1a, 0xe9, 0x24, 0xb3, 0x93, 0xef, 0x3b, 0xa1, 0x69, 0x1f, 0x5d, 0x3e, 0x29, 0xb3, 0xf4, 0x61, 0x88, 0x0c, 0xcb, 0x76, 0xd8, 0x0a, 0xec, 0xcd, 0x39, 0xc7, 0xa6, 0xb3, 0x61, 0x66, 0x77, 0xd2, 0x5d, 0xff, 0x8f, 0x73, 0xe8, 0xdb, 0xdf, 0x7e, 0x29, 0x2c, 0xc4, 0xfe, 0x3b, 0x76, 0x9c, 0xd6, 0x3b, 0x7c, 0xff, 0xf4, 0x1f, 0xac, 0x09, 0x26, 0xa8, 0x7f, 0x92, 0x5f, 0x20, 0x27, 0x2f, 0x1d, 0xa4, 0x9d, 0xac, 0xfb, 0xf1, 0xa2, 0x15, 0xc5, 0xe9, 0x45, 0x3a, 0x09, 0xef, 0xc3, 0x2f, 0x13, 0xcd, 0xfb, 0x64, 0x59, 0x8f, 0xc7, 0xaf, 0x91, 0x4c, 0x68, 0x96, 0xc3, 0x4a, 0x94, 0x05, 0xb6, 0xcb, 0x55, 0xe5, 0x9b, 0xd7, 0xff, 0xc3, 0xe7, 0xc1, 0x00, 0xcf, 0x38, 0xec, 0xcd, 0x4f, 0xe3, 0x38, 0x3d, 0x37, 0xe1, 0xe3, 0xd9, 0x03, 0x2c, 0x09, 0xf0, 0xd9, 0xbc, 0x6d, 0xc9, 0x90, 0x18, 0xc8, 0xcb, 0x25, 0x10, 0x42, 0x80, 0x05, 0x34, 0x63, 0x07, 0xc6, 0xd6, 0xc3, 0x38, 0x14, 0xcc, 0xd1, 0xa7, 0x07, 0x0f, 0x92, 0xfb, 0xfb, 0xb3, 0x8c, 0x82, 0x2d, 0xa3, 0x34, 0x45, 0x03, 0x63, 0x62, 0xa7, 0xea, 0x3b, 0x9b, 0xba, 0x71, 0xdb, 0xb5, 0xff, 0xa1, 0x26, 0xa1, 0x67, 0x0d, 0x2e, 0x78, 0x7d, 0x81, 0x3f, 0xfd, 0xea, 0xd7, 0x44, 0xf6, 0xe5, 0x8b, 0x17, 0xcf, 0x5f, 0x64, 0x01, 0x8b, 0x13, 0xe6, 0x7e, 0x90, 0x6a, 0x8a, 0x4a, 0x45, 0x7e, 0x7a, 0x43, 0x4e, 0x70, 0xac, 0xe8, 0x37, 0xcf, 0x5e, 0xbc, 0x60, 0x96, 0x13, 0x3b, 0x46, 0xff, 0xdc, 0x96, 0xec, 0xe5, 0xe5, 0xab, 0x7b, 0xac, 0xaa, 0x93, 0x89, 0xea, 0x56, 0xe7, 0x65, 0xe1, 0x1a, 0x40, 0x78, 0x48, 0xe0, 0xcb, 0x56, 0x1b, 0xb4, 0xbc, 0xff, 0xfb, 0x18, 0xcd, 0xfe, 0x07, 0x49, 0x14, 0x6f, 0x23, 0x55, 0x1b, 0x00, 0x00 };
+const uint8_t FILE_MODELS_JS_BODY[] PROGMEM = { 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xed, 0x3c, 0xdb, 0x72, 0xdb, 0xc6, 0x92, 0xef, 0xfa, 0x8a, 0x16, 0xe3, 0x63, 0x82, 0x16, 0x0c, 0x4a, 0x4e, 0x4e, 0xd6, 0x45, 0x99, 0x56, 0xf9, 0x96, 0xb3, 0xae, 0x4a, 0x9c, 0x54, 0xe4, 0x9c, 0xdd, 0x2a, 0x95, 0xd6, 0x02, 0x81, 0xa1, 0x08, 0x0b, 0x04, 0x68, 0xcc, 0x40, 0x34, 0x2d, 0x73, 0xbf, 0x7d, 0xab, 0x7b, 0xee, 0xb8, 0x48, 0x54, 0xe2, 0xb3, 0xb5, 0x0f, 0xeb, 0x87, 0x44, 0x1c, 0xcc, 0xf4, 0x74, 0xf7, 0xf4, 0x7d, 0x1a, 0x18, 0xd4, 0x9c, 0x01, 0x17, 0x55, 0x96, 0x88, 0xc1, 0xf1, 0xde, 0x5e, 0x52, 0x16, 0x5c, 0xc0, 0x07, 0x2e, 0xaa, 0x3a, 0x11, 0x1c, 0xa6, 0x70, 0xb3, 0x3d, 0xde, 0xdb, 0x1b, 0x3f, 0x02, 0x78, 0xc1, 0x37, 0x45, 0xf2, 0xb2, 0x9e, 0xcf, 0x59, 0xf5, 0xe2, 0xb7, 0xb7, 0x7b, 0x00, 0x00, 0x2f, 0x37, 0x13, 0x38, 0x5d, 0xb0, 0x18, 0xde, 0x5e, 0xb3, 0x0d, 0x8d, 0xfc, 0x93, 0x55, 0x3c, 0x2b, 0x8b, 0x09, 0x1c, 0x45, 0x87, 0xd1, 0xe1, 0x87, 0x97, 0x6f, 0xde, 0xbf, 0xa0, 0xf1, 0x33, 0xb8, 0x62, 0x9b, 0x10, 0x6e, 0x20, 0x9b, 0x66, 0x69, 0x08, 0x7c, 0x3a, 0xdb, 0x08, 0x06, 0x3c, 0xfb, 0xc2, 0x42, 0x58, 0x4e, 0x67, 0x04, 0x15, 0x92, 0xb2, 0xb8, 0x96, 0xeb, 0x61, 0xc9, 0xc4, 0xa2, 0x4c, 0x43, 0x58, 0x4d, 0x57, 0x55, 0xb6, 0xcc, 0x44, 0x76, 0xcd, 0x60, 0x0b, 0xe7, 0x21, 0x8c, 0xc7, 0xf0, 0x9b, 0x19, 0x11, 0x9b, 0x15, 0x83, 0x79, 0x59, 0x2d, 0x63, 0xe1, 0xef, 0x82, 0xd3, 0x4e, 0x89, 0x84, 0xd6, 0x1c, 0x80, 0x2c, 0x9d, 0xc0, 0x51, 0xa8, 0x7e, 0x14, 0xf1, 0x92, 0x4d, 0x60, 0x20, 0xe9, 0x7d, 0x17, 0x2f, 0xd9, 0x40, 0x3f, 0x31, 0x1b, 0x4f, 0x60, 0x1e, 0xe7, 0x9c, 0xe9, 0xf1, 0x79, 0xc6, 0xf2, 0x94, 0x4f, 0xe0, 0x0c, 0xd4, 0x00, 0xc0, 0x8d, 0xfd, 0x13, 0x68, 0xc3, 0x09, 0x0c, 0x06, 0x84, 0xeb, 0xca, 0xc7, 0xb5, 0xac, 0x80, 0x5b, 0xb4, 0x9c, 0x45, 0x0a, 0x8d, 0x41, 0x48, 0xa8, 0xaf, 0xe2, 0x2a, 0x5e, 0x32, 0xc1, 0x2a, 0x1a, 0x77, 0xa6, 0xc5, 0x55, 0x15, 0x6f, 0x4e, 0xb3, 0x2f, 0x6c, 0x02, 0x87, 0x04, 0x9f, 0x06, 0x88, 0x8f, 0xce, 0xac, 0x59, 0x26, 0xb8, 0x9e, 0x30, 0xcb, 0x04, 0x21, 0x0c, 0xeb, 0x2c, 0x15, 0x8b, 0x10, 0xd6, 0x99, 0x58, 0x58, 0x30, 0xc0, 0xe2, 0x64, 0x01, 0x2c, 0x67, 0x4b, 0x56, 0x08, 0xc8, 0x38, 0xac, 0xe2, 0xe4, 0x8a, 0xa5, 0x20, 0x4a, 0x10, 0x8b, 0x8c, 0xcb, 0x45, 0x0e, 0xe4, 0xeb, 0x38, 0xaf, 0x71, 0x6f, 0x84, 0x9c, 0xb2, 0x79, 0x5c, 0xe7, 0x42, 0x8e, 0x99, 0x39, 0x5b, 0xf5, 0xd7, 0xb9, 0x64, 0xc9, 0x36, 0x84, 0x28, 0x8a, 0xe0, 0x3c, 0xdc, 0x7b, 0x34, 0xde, 0x4b, 0xf2, 0x98, 0xf3, 0x86, 0x1c, 0xc1, 0xcd, 0x1e, 0xc0, 0x77, 0xc8, 0x8d, 0x7f, 0x67, 0x71, 0xca, 0x2a, 0x98, 0xc2, 0xe0, 0x3f, 0x1f, 0xbf, 0xdf, 0xac, 0xd8, 0xe0, 0x18, 0x9f, 0x24, 0x0b, 0x96, 0x5c, 0xf1, 0x7a, 0xe9, 0x3e, 0x7d, 0xa5, 0xc6, 0xe4, 0x0c, 0xce, 0x3e, 0xb9, 0x0f, 0x4f, 0xd9, 0x27, 0x33, 0x7e, 0x2a, 0xe2, 0x4a, 0x34, 0x1e, 0x3e, 0xa6, 0x41, 0x39, 0x25, 0x4b, 0xdf, 0x16, 0x29, 0xfb, 0x0c, 0x53, 0x38, 0xa4, 0xdf, 0xe6, 0xb4, 0x70, 0x7f, 0x12, 0x7e, 0x22, 0x62, 0x30, 0x2b, 0xcb, 0x7c, 0x30, 0x81, 0x1b, 0xe0, 0x28, 0x39, 0xb0, 0x9c, 0xc0, 0xe0, 0x8f, 0xac, 0x10, 0x83, 0x10, 0x56, 0x13, 0x10, 0x55, 0xcd, 0x60, 0x2b, 0xa5, 0x63, 0x90, 0x2c, 0xe2, 0xaa, 0x31, 0xf3, 0x6d, 0xe7, 0xc4, 0xba, 0xe0, 0xd9, 0x65, 0xc1, 0x52, 0xe8, 0x58, 0xd1, 0x03, 0x3b, 0x2b, 0xc4, 0xd3, 0x0f, 0x62, 0x37, 0xe8, 0x9d, 0x73, 0x7b, 0xe0, 0xf2, 0x45, 0x59, 0x99, 0xa9, 0x4f, 0x76, 0x42, 0xba, 0x6b, 0x49, 0x3f, 0xd6, 0x47, 0x3f, 0x7e, 0xd8, 0x11, 0x7e, 0xf7, 0xe4, 0x7e, 0xc8, 0x7a, 0xe2, 0x0f, 0x3b, 0x61, 0xdd, 0x5e, 0xd0, 0x03, 0x39, 0x2f, 0x8b, 0xcb, 0xfb, 0x81, 0xee, 0x58, 0xd1, 0x8f, 0xf5, 0xf7, 0x4f, 0x3e, 0xec, 0x88, 0x79, 0xf7, 0xe4, 0xbe, 0x73, 0xcc, 0xbe, 0xb0, 0x1d, 0x01, 0xcf, 0xf3, 0x32, 0x6e, 0xce, 0xfc, 0x89, 0xc6, 0xda, 0x73, 0xd3, 0xb2, 0x9e, 0xe5, 0x4c, 0x4f, 0x7e, 0x7a, 0xfb, 0x64, 0xe4, 0x83, 0xc7, 0x0c, 0x35, 0xff, 0x65, 0x76, 0xb9, 0x03, 0x07, 0x7b, 0x56, 0xf6, 0x73, 0xf2, 0xc7, 0x1f, 0x2c, 0xc1, 0x77, 0xee, 0xd4, 0x3b, 0xbf, 0x0b, 0xfe, 0x96, 0x0c, 0xc2, 0x07, 0xa1, 0x0c, 0x41, 0xc1, 0xd6, 0xf0, 0x4b, 0xbc, 0x0a, 0x46, 0xce, 0xf0, 0xcb, 0xcd, 0xa9, 0xa8, 0xb2, 0xe2, 0xd2, 0x7f, 0xbc, 0x07, 0x40, 0x3e, 0x14, 0xad, 0x7c, 0x59, 0x05, 0x49, 0x59, 0xcc, 0xb3, 0x4b, 0xf2, 0xa3, 0x23, 0x65, 0x4e, 0xd0, 0xb2, 0x46, 0x76, 0x5c, 0xfb, 0x8e, 0x45, 0xc9, 0xc5, 0x84, 0xfc, 0x42, 0x39, 0x87, 0xbc, 0x4c, 0x62, 0x81, 0x8e, 0x70, 0x3a, 0x9d, 0xc2, 0xa0, 0x9c, 0x7d, 0x64, 0x89, 0x18, 0xc0, 0x89, 0x19, 0x8f, 0x70, 0x36, 0x4c, 0x60, 0x38, 0x0c, 0xf5, 0xfa, 0x59, 0xcc, 0xd9, 0x1f, 0x55, 0x4e, 0x63, 0x6a, 0x68, 0xcd, 0xe5, 0xc0, 0x78, 0xcd, 0xed, 0xbc, 0x9a, 0x33, 0x6d, 0x40, 0x25, 0xc1, 0xe6, 0x09, 0x2b, 0xe2, 0x59, 0xce, 0x5e, 0xb3, 0x59, 0x7d, 0xa9, 0x7d, 0x9e, 0x7e, 0x14, 0x45, 0x1a, 0x63, 0x69, 0xd6, 0x8f, 0x2d, 0x25, 0x71, 0x9a, 0xa2, 0xb9, 0x0c, 0xe8, 0x47, 0xc3, 0x84, 0x8e, 0xe4, 0xbc, 0x6c, 0x0e, 0x81, 0x22, 0xcc, 0x46, 0x16, 0x96, 0x2e, 0xcd, 0x98, 0x06, 0x40, 0x3d, 0x55, 0x01, 0x41, 0xcf, 0xb2, 0x45, 0xf6, 0x8e, 0xc7, 0xf0, 0x13, 0x13, 0xc9, 0x02, 0xd0, 0x7d, 0x70, 0x96, 0x20, 0x3f, 0xf6, 0x00, 0x62, 0xf4, 0x2b, 0x30, 0xc7, 0x27, 0x81, 0x0c, 0x1f, 0xd0, 0xe6, 0xff, 0xe3, 0xcd, 0xfb, 0x41, 0x08, 0x75, 0x95, 0x87, 0xd2, 0x03, 0x4f, 0xa1, 0xa8, 0xf3, 0x3c, 0x84, 0x34, 0x16, 0xb1, 0xf9, 0x51, 0xae, 0x10, 0x06, 0xf7, 0x4e, 0x49, 0x05, 0x42, 0xce, 0x23, 0x13, 0x94, 0x2c, 0xc8, 0xa3, 0xf0, 0x09, 0xdc, 0x48, 0xf7, 0xa6, 0xe6, 0x6c, 0x35, 0xb1, 0x44, 0x2b, 0xec, 0x4f, 0x25, 0x78, 0x87, 0x3a, 0x89, 0x00, 0x11, 0x79, 0xc9, 0x84, 0xe4, 0xda, 0x66, 0xc5, 0x14, 0x81, 0x60, 0x76, 0x8b, 0xd4, 0x0e, 0x67, 0x92, 0xa7, 0xd6, 0x3b, 0x9e, 0xe3, 0xf2, 0xcd, 0x8a, 0x45, 0x59, 0x6a, 0x99, 0x22, 0xf9, 0xab, 0x48, 0xde, 0x57, 0x34, 0x8f, 0x30, 0x0a, 0xc2, 0x7f, 0x4d, 0xd0, 0xb3, 0x32, 0xdd, 0x68, 0x24, 0x58, 0x91, 0x94, 0xa9, 0xc4, 0xe1, 0x24, 0xca, 0x52, 0xf8, 0xfa, 0xd5, 0xe5, 0xce, 0xd7, 0xaf, 0x70, 0xd8, 0x46, 0x0d, 0xd7, 0xbf, 0x66, 0xb8, 0x0e, 0xf9, 0x8b, 0x13, 0x7b, 0xb1, 0x1f, 0xbc, 0x2a, 0x0b, 0xc1, 0x0a, 0x21, 0xdd, 0x39, 0xe2, 0x3e, 0x10, 0xec, 0xb3, 0x18, 0xaf, 0xf2, 0x38, 0x2b, 0x06, 0x7a, 0x19, 0x09, 0x87, 0x55, 0x89, 0xc8, 0x91, 0x4f, 0xcb, 0xba, 0x5e, 0xde, 0xf8, 0xf1, 0xc1, 0xb9, 0xa6, 0xec, 0xbb, 0xa4, 0x5c, 0xae, 0x6a, 0x61, 0x20, 0x05, 0xa8, 0xa1, 0xa8, 0xe7, 0x4f, 0x5f, 0x60, 0xec, 0x13, 0x78, 0xe4, 0x8c, 0x46, 0x91, 0x28, 0xa5, 0x2e, 0x07, 0x86, 0xe0, 0xad, 0xc3, 0x5f, 0x96, 0x73, 0x66, 0x50, 0xf9, 0xd6, 0xf8, 0x0e, 0x06, 0x5d, 0x5b, 0xe6, 0x4c, 0x40, 0x59, 0x8b, 0x55, 0x2d, 0x94, 0x94, 0x1e, 0x3b, 0x52, 0x59, 0x31, 0xbe, 0x2a, 0x0b, 0x8e, 0xc2, 0x14, 0xaf, 0xe3, 0x4c, 0x28, 0xa9, 0xbf, 0x78, 0x70, 0xe3, 0x22, 0xa6, 0x0c, 0xc2, 0xf6, 0xc1, 0x4d, 0x5d, 0xe5, 0xdb, 0x8b, 0xd0, 0xa0, 0xa4, 0x68, 0xd4, 0x50, 0x22, 0xa3, 0x2d, 0xf2, 0x8f, 0xc6, 0xd3, 0x8a, 0x7d, 0xaa, 0x19, 0x17, 0x9e, 0x06, 0x18, 0x7d, 0x92, 0x06, 0xeb, 0x24, 0xc2, 0x38, 0xd5, 0x17, 0x1f, 0xab, 0x55, 0x5b, 0x6b, 0x04, 0xf6, 0x0d, 0xd4, 0xf2, 0xca, 0x32, 0xcb, 0xd0, 0x29, 0x89, 0x31, 0x73, 0x50, 0x58, 0xec, 0x81, 0x54, 0x4c, 0xd4, 0x55, 0x01, 0x67, 0x72, 0x76, 0x68, 0xa6, 0x85, 0x1d, 0x28, 0x9c, 0xfb, 0xda, 0x11, 0x18, 0x90, 0xea, 0x30, 0x50, 0xfd, 0x02, 0x5f, 0x3c, 0x47, 0x64, 0x6a, 0x87, 0xf1, 0x6a, 0x95, 0x67, 0xd2, 0xc6, 0x8e, 0xcb, 0x44, 0x30, 0xf1, 0x98, 0x8b, 0x8a, 0xc5, 0xcb, 0x21, 0x3c, 0x7c, 0x08, 0x2d, 0x30, 0x8b, 0x98, 0x07, 0x4d, 0x1d, 0x1d, 0x59, 0xc2, 0xe4, 0x69, 0xa9, 0xec, 0xa6, 0x45, 0x1e, 0x45, 0xe1, 0x32, 0x10, 0xb6, 0x54, 0x76, 0x21, 0x6b, 0x77, 0xf1, 0xa5, 0x67, 0xe4, 0xca, 0x9b, 0xdc, 0x4b, 0x89, 0x7d, 0xaa, 0x25, 0x72, 0x57, 0x7d, 0x90, 0x38, 0x76, 0x2a, 0x42, 0x53, 0xe8, 0x1c, 0xd0, 0x9d, 0x6c, 0xed, 0xc4, 0xd4, 0x02, 0xbb, 0x45, 0x7d, 0x5c, 0x16, 0x9b, 0xb1, 0xfd, 0x69, 0x8b, 0x28, 0x63, 0xdb, 0x1c, 0xfb, 0x26, 0xbd, 0x47, 0x55, 0xae, 0xc9, 0x17, 0xbf, 0xa9, 0xaa, 0xb2, 0x0a, 0x86, 0x06, 0xc8, 0x3c, 0xce, 0x72, 0x96, 0xee, 0x0f, 0x1d, 0x3c, 0xb6, 0x7b, 0xfe, 0xff, 0xbb, 0x8c, 0xf3, 0x2d, 0xf4, 0xb9, 0xe7, 0xbd, 0xdb, 0xd9, 0x99, 0x3c, 0xc5, 0x3b, 0xb6, 0xf1, 0x18, 0x28, 0x86, 0x50, 0x42, 0xa2, 0xd7, 0x9b, 0xe7, 0x46, 0x37, 0x6e, 0x1c, 0x42, 0x39, 0xa6, 0x30, 0x13, 0x4c, 0x13, 0x39, 0x7b, 0x5b, 0x88, 0xdb, 0xf0, 0xf4, 0xb3, 0xa0, 0x51, 0x08, 0x47, 0x87, 0xa3, 0xd0, 0x05, 0xc5, 0x3e, 0xed, 0x0c, 0xa8, 0x0f, 0x46, 0xc5, 0x92, 0xb2, 0xc2, 0x94, 0x98, 0x66, 0xa6, 0xe4, 0x1c, 0x7e, 0x97, 0x63, 0x81, 0xf2, 0x56, 0xa1, 0x22, 0x70, 0x64, 0xf9, 0x7f, 0xdc, 0x38, 0x00, 0xcf, 0xc8, 0x3a, 0x84, 0x3b, 0x40, 0x5b, 0xd0, 0xee, 0x34, 0xd6, 0xbb, 0x98, 0x96, 0xad, 0x6f, 0xef, 0x7c, 0x07, 0x27, 0x01, 0x58, 0xcf, 0xee, 0x48, 0xae, 0x13, 0x2e, 0xf9, 0x2a, 0x5f, 0xe6, 0x2c, 0xca, 0xcb, 0x4b, 0xb4, 0xc7, 0xc6, 0x0b, 0x48, 0xcb, 0xb9, 0x9d, 0xc0, 0x1d, 0x36, 0x5a, 0xa3, 0xd1, 0xc0, 0xed, 0x9e, 0xa6, 0x6f, 0x6b, 0xe2, 0x21, 0x3c, 0xc0, 0x76, 0xf4, 0xd3, 0x08, 0x78, 0xf4, 0x06, 0x92, 0x49, 0x84, 0x9f, 0xf4, 0x28, 0xc3, 0x7f, 0xbc, 0x79, 0x3f, 0x74, 0xcc, 0x7d, 0xe8, 0xaf, 0x1f, 0x1d, 0xcb, 0x63, 0x94, 0x5b, 0xad, 0x6a, 0x67, 0xab, 0xdb, 0x23, 0xac, 0xfe, 0x0d, 0x7f, 0xfb, 0xa3, 0xb1, 0xa1, 0xe7, 0x4b, 0x1a, 0x1b, 0x96, 0xfc, 0x5b, 0xec, 0xf8, 0xeb, 0xe9, 0xee, 0x5b, 0xa6, 0x2c, 0x67, 0x82, 0xfd, 0xf5, 0x4d, 0x5f, 0xbf, 0xf9, 0xf9, 0xcd, 0xfb, 0x37, 0x77, 0x6e, 0x2b, 0xa3, 0xdd, 0xdf, 0x1d, 0x03, 0xc1, 0x59, 0x95, 0x31, 0xee, 0x84, 0xbd, 0xe3, 0xb1, 0x1e, 0x43, 0x07, 0x4d, 0xea, 0x5c, 0xb0, 0xcf, 0x02, 0xff, 0xaa, 0x59, 0x91, 0x30, 0x28, 0xea, 0xe5, 0x8c, 0x55, 0x58, 0xd2, 0xa1, 0xbd, 0xb1, 0x06, 0x85, 0xc8, 0xc2, 0x8c, 0xcd, 0xcb, 0x8a, 0x81, 0x58, 0x30, 0x98, 0x67, 0x15, 0x57, 0x41, 0x44, 0x28, 0xeb, 0x39, 0x7c, 0xa2, 0xb5, 0x1a, 0xca, 0x3c, 0x45, 0xf7, 0x4f, 0x73, 0x42, 0x58, 0x66, 0x9c, 0xb3, 0xd4, 0x3e, 0xcd, 0x31, 0x0f, 0x99, 0x6d, 0x30, 0x5d, 0xc8, 0x09, 0x4d, 0xb6, 0xc8, 0x8a, 0x34, 0x84, 0x65, 0xfc, 0xf9, 0x67, 0x56, 0x5c, 0x8a, 0x05, 0x56, 0x8b, 0xea, 0x22, 0xc7, 0xac, 0x80, 0xa5, 0x24, 0x98, 0x49, 0xc5, 0x62, 0xc1, 0x4e, 0x09, 0xe9, 0xc0, 0xcc, 0xc3, 0x22, 0x8c, 0x56, 0x23, 0xc5, 0x36, 0x4d, 0x0e, 0xb1, 0x56, 0xa3, 0x75, 0x76, 0x6e, 0x91, 0x38, 0x74, 0xf6, 0x91, 0xa7, 0xb4, 0x95, 0x1c, 0x51, 0x94, 0x16, 0xf9, 0x86, 0xe8, 0xd3, 0xc8, 0xc6, 0x29, 0x2a, 0x35, 0xcf, 0x90, 0x2d, 0x38, 0x9e, 0xc7, 0xe8, 0x32, 0xe3, 0x3c, 0x87, 0xb8, 0x48, 0x21, 0x5e, 0xad, 0x58, 0x91, 0xe2, 0x83, 0xa5, 0x2c, 0x80, 0x31, 0xc5, 0x59, 0x57, 0x99, 0x14, 0xda, 0x74, 0x6c, 0xf2, 0xe9, 0x6d, 0xe9, 0x03, 0x67, 0x58, 0xca, 0x13, 0x25, 0x7a, 0xff, 0xba, 0xca, 0xa3, 0x0c, 0xcb, 0x4d, 0xbf, 0xce, 0x83, 0xe1, 0xc9, 0x50, 0xc6, 0x1b, 0x8f, 0x8f, 0xe0, 0x04, 0x86, 0x27, 0x43, 0x4c, 0xe5, 0x1e, 0x0e, 0xdd, 0x18, 0xaf, 0x47, 0xd9, 0xcf, 0x8d, 0x2d, 0x6b, 0xab, 0xe9, 0x85, 0xb4, 0x22, 0x0f, 0x6e, 0xcc, 0xb6, 0x5b, 0xa2, 0x75, 0x8a, 0x23, 0x88, 0x6a, 0xc4, 0xd9, 0x27, 0x38, 0x39, 0x81, 0x43, 0xb4, 0x34, 0x92, 0xad, 0x0d, 0x7d, 0x36, 0x91, 0x9a, 0x13, 0xa8, 0xdd, 0x11, 0xf9, 0x74, 0xf9, 0x35, 0x99, 0xc7, 0x11, 0x3f, 0x15, 0xc3, 0x0c, 0xaf, 0x88, 0x2a, 0xcf, 0xba, 0x91, 0xc1, 0x6e, 0xec, 0xe9, 0x82, 0xf2, 0x9d, 0xfa, 0xc5, 0x50, 0x52, 0x39, 0xc4, 0x72, 0x65, 0x51, 0x0a, 0x88, 0x7d, 0x07, 0x5a, 0xd6, 0x82, 0x49, 0x09, 0xc1, 0x51, 0x65, 0x6d, 0x2d, 0x92, 0x5b, 0x95, 0xbd, 0x5d, 0x74, 0x1a, 0x58, 0x8d, 0x65, 0x83, 0xe7, 0xc6, 0xa4, 0x76, 0x51, 0x74, 0x23, 0xdd, 0x31, 0x8a, 0xc3, 0xa7, 0xd0, 0x88, 0x9a, 0x11, 0x84, 0xf1, 0x18, 0xca, 0xa2, 0xa9, 0x65, 0xb0, 0x5e, 0xc4, 0x82, 0x5d, 0xb3, 0x0a, 0x16, 0x19, 0x17, 0x65, 0x25, 0xc5, 0x34, 0x65, 0xd7, 0x59, 0xc2, 0x20, 0xce, 0x2b, 0x16, 0xa7, 0x1b, 0x48, 0xab, 0x72, 0xb5, 0x62, 0x29, 0xac, 0x63, 0x0e, 0x05, 0x4d, 0x96, 0x72, 0xef, 0xca, 0xd7, 0xa6, 0x48, 0xc8, 0x4d, 0x39, 0xe7, 0xab, 0xf3, 0x4e, 0x7b, 0x96, 0x6a, 0xd6, 0xc3, 0x87, 0x12, 0x53, 0x78, 0xe6, 0x4c, 0xb7, 0x8c, 0xa6, 0x92, 0x2e, 0x21, 0x60, 0x4c, 0x47, 0xc5, 0x68, 0x01, 0x4b, 0x43, 0x42, 0x46, 0xaa, 0x84, 0x88, 0x73, 0xa6, 0xd1, 0xde, 0xd3, 0x41, 0x04, 0x81, 0x93, 0x2a, 0x0a, 0x53, 0x38, 0x3b, 0xef, 0x3c, 0xdf, 0x26, 0x1e, 0xcf, 0xfb, 0xf0, 0x98, 0x33, 0xb2, 0x4f, 0xd2, 0x92, 0x90, 0x02, 0xe3, 0x59, 0xae, 0xab, 0x98, 0xf8, 0xb1, 0x42, 0xad, 0x2d, 0xeb, 0x0a, 0x92, 0xba, 0xe2, 0x65, 0xe5, 0xe3, 0x20, 0x59, 0x04, 0x07, 0x53, 0xb5, 0xc7, 0x63, 0x67, 0x0f, 0x17, 0xa9, 0x79, 0x59, 0x41, 0xa0, 0x03, 0x5b, 0x3c, 0x32, 0x28, 0xe7, 0xfa, 0xf0, 0x2c, 0x2e, 0x1e, 0x61, 0xd1, 0xaa, 0xe6, 0x8b, 0x40, 0xce, 0x19, 0x1d, 0x93, 0xe1, 0x5d, 0xe1, 0x49, 0x21, 0x6e, 0x31, 0xe4, 0x71, 0x75, 0xe9, 0x9f, 0x71, 0x79, 0xcd, 0xaa, 0x79, 0x5e, 0xae, 0x39, 0x91, 0x40, 0x66, 0x86, 0x8b, 0x38, 0xb9, 0x6a, 0x24, 0xee, 0x1a, 0x71, 0x63, 0xc8, 0x90, 0x3f, 0xde, 0xbe, 0xb9, 0x1c, 0x37, 0xec, 0x32, 0x53, 0xfb, 0x10, 0xe5, 0x98, 0xc3, 0xb0, 0xe0, 0x30, 0xec, 0x06, 0xf4, 0xb8, 0x0d, 0xc8, 0x65, 0x8d, 0x23, 0x4b, 0x28, 0x58, 0x9f, 0x8e, 0x5d, 0x15, 0x91, 0x0f, 0x8f, 0x9d, 0x5a, 0xcc, 0x78, 0x0c, 0xff, 0xc1, 0x66, 0xa7, 0x65, 0x72, 0xc5, 0x04, 0x6f, 0xd4, 0x64, 0xd6, 0xdc, 0xc9, 0x5e, 0xbf, 0x5b, 0xf3, 0x57, 0xe5, 0x72, 0x89, 0xa6, 0xb6, 0x59, 0x50, 0x5b, 0xf3, 0x53, 0xed, 0xc3, 0xbc, 0x07, 0x18, 0x1d, 0xb3, 0xcb, 0x8c, 0xe3, 0x55, 0x08, 0xbb, 0xc6, 0x3b, 0x8a, 0x1c, 0x7f, 0x14, 0xac, 0x42, 0xa5, 0x5a, 0xc5, 0x74, 0x39, 0x51, 0x16, 0x41, 0x22, 0xe1, 0x86, 0x90, 0xcc, 0xbc, 0x2a, 0x9b, 0xdd, 0x32, 0xe2, 0x4c, 0x78, 0xd3, 0x1c, 0x6f, 0x61, 0xb6, 0xf0, 0x4d, 0x89, 0xde, 0x8a, 0x94, 0x9a, 0x65, 0xd7, 0x2c, 0xb5, 0x8e, 0xa4, 0x62, 0xca, 0x18, 0xc8, 0xcb, 0x12, 0xe3, 0x27, 0xca, 0x42, 0x59, 0x07, 0xb3, 0x95, 0x36, 0x13, 0x6d, 0xcc, 0x4e, 0x35, 0x9f, 0x45, 0x73, 0xf6, 0xc8, 0x29, 0xaf, 0x35, 0xa8, 0xf3, 0xd0, 0x96, 0x89, 0xf9, 0x6d, 0x1e, 0x4e, 0x85, 0x06, 0x68, 0x42, 0xc8, 0xd9, 0xd5, 0xab, 0x34, 0x16, 0x64, 0x42, 0xb8, 0xb5, 0x64, 0x0a, 0xbe, 0x87, 0x1f, 0x3e, 0xb6, 0x1b, 0xdb, 0x4a, 0x74, 0xd8, 0x44, 0xff, 0xd2, 0xa2, 0x3f, 0x32, 0xfe, 0xc5, 0x45, 0x13, 0x21, 0xc1, 0x92, 0x71, 0x1e, 0x5f, 0x32, 0xe7, 0xd4, 0xfc, 0x0d, 0xfa, 0x6b, 0x73, 0x15, 0x13, 0x15, 0x16, 0xac, 0xbe, 0xf7, 0xd0, 0x2b, 0x57, 0xac, 0x08, 0xa4, 0x12, 0x2e, 0xe3, 0x2b, 0x06, 0xbc, 0x56, 0xa1, 0x4c, 0x52, 0x16, 0x85, 0x14, 0x3f, 0xf4, 0x0f, 0x38, 0x2d, 0xd2, 0xb1, 0x7b, 0xbc, 0xca, 0xa2, 0x35, 0x8f, 0xc8, 0xb8, 0x9e, 0x8a, 0x58, 0xc8, 0x12, 0xdd, 0x91, 0x74, 0x6f, 0xa2, 0xda, 0xb8, 0xda, 0x24, 0xde, 0x67, 0x4b, 0x56, 0xd6, 0x22, 0x08, 0x46, 0x30, 0x7d, 0xde, 0xc5, 0x12, 0x37, 0x66, 0xa3, 0xe5, 0x8f, 0x8f, 0x28, 0x33, 0x3a, 0x6c, 0x14, 0x2c, 0x5c, 0xcd, 0x92, 0xf6, 0x46, 0x56, 0xdd, 0x2a, 0x25, 0xeb, 0xef, 0xd9, 0x67, 0xf1, 0x46, 0x8e, 0xe8, 0x84, 0x04, 0x6b, 0x3f, 0x0b, 0x7d, 0x6b, 0x75, 0xf1, 0xe0, 0x46, 0xed, 0xb9, 0x3d, 0xbe, 0x20, 0x82, 0xd5, 0x4f, 0x33, 0x55, 0x55, 0xf4, 0x1a, 0x19, 0xfd, 0xa1, 0x03, 0x0c, 0x71, 0x7d, 0x5b, 0xcc, 0x4b, 0xf0, 0x3d, 0x83, 0x5f, 0xa7, 0x44, 0x3e, 0x10, 0xe7, 0xbb, 0x0b, 0x97, 0x6a, 0x7d, 0x7f, 0xf1, 0x52, 0x61, 0x7c, 0x40, 0x28, 0xeb, 0x15, 0x51, 0x66, 0xd0, 0x76, 0x6e, 0x3c, 0xbb, 0x31, 0x6e, 0x96, 0x24, 0x25, 0x77, 0x47, 0xf2, 0x94, 0xe5, 0x78, 0x4a, 0x4b, 0xfb, 0x92, 0x3d, 0x8b, 0xc1, 0xf0, 0x78, 0x48, 0xab, 0x8a, 0xd2, 0xdc, 0xbb, 0x36, 0x16, 0x1a, 0xfe, 0xaa, 0xd3, 0xd0, 0x1b, 0x2f, 0xdc, 0x7a, 0x05, 0x71, 0x57, 0x57, 0x6f, 0x1a, 0xd8, 0xca, 0x89, 0xda, 0xa4, 0x1e, 0x10, 0x7c, 0xf5, 0x4b, 0xad, 0x96, 0x2b, 0x49, 0xbf, 0xe5, 0xe4, 0xd0, 0xd4, 0x53, 0x9d, 0x47, 0xb8, 0x4e, 0x97, 0x94, 0xfd, 0xf5, 0xc4, 0x8f, 0xb5, 0x92, 0x3b, 0xb5, 0xc2, 0xcb, 0x7b, 0xef, 0x9d, 0x8f, 0xae, 0x39, 0xa9, 0x1d, 0x26, 0xa1, 0x5a, 0xa6, 0xc0, 0x9e, 0x15, 0x9c, 0xc0, 0xc5, 0x33, 0xe7, 0xe8, 0x30, 0xab, 0xdc, 0x3e, 0xbf, 0x00, 0xbc, 0x97, 0xc6, 0x80, 0x91, 0x4e, 0xc3, 0xad, 0xc5, 0x93, 0x7a, 0x27, 0x79, 0xc9, 0xa5, 0xea, 0xad, 0xd9, 0x8c, 0x93, 0x17, 0xc0, 0x18, 0x1f, 0x47, 0x03, 0x8d, 0x46, 0x36, 0x0f, 0xf6, 0x15, 0x35, 0x98, 0xa6, 0x6a, 0xc2, 0x1c, 0x4d, 0xc4, 0x58, 0xf8, 0xfb, 0x91, 0x56, 0x19, 0xba, 0xd9, 0x56, 0x51, 0x10, 0x41, 0x4a, 0x3d, 0x86, 0x28, 0xe0, 0x1e, 0x97, 0x1c, 0xd1, 0x56, 0x88, 0xa1, 0xee, 0xb7, 0xf0, 0x92, 0x76, 0xc3, 0xa2, 0xa5, 0x57, 0x3f, 0x7c, 0xd8, 0x85, 0xd5, 0x7e, 0x1f, 0x52, 0x59, 0x91, 0x89, 0x2c, 0xce, 0xb3, 0x2f, 0x3e, 0x66, 0x4a, 0x4a, 0x8c, 0x3b, 0x44, 0x8e, 0x4f, 0xc6, 0x63, 0x3f, 0xe5, 0xc7, 0x9b, 0x9b, 0xad, 0x3f, 0x44, 0xf7, 0x34, 0xdb, 0x8b, 0xc6, 0xb9, 0xc7, 0x69, 0xfa, 0x06, 0x7d, 0xde, 0xcf, 0xca, 0x0f, 0x05, 0x03, 0xc4, 0x7e, 0x10, 0x42, 0xc0, 0xc8, 0x28, 0xf9, 0x55, 0xc6, 0x64, 0x66, 0x6a, 0x7d, 0xd6, 0xe9, 0xa1, 0x71, 0x1e, 0xe2, 0x2a, 0x5b, 0xf9, 0x4a, 0x66, 0x48, 0x6c, 0x32, 0x0b, 0x98, 0x5b, 0xb7, 0xba, 0x53, 0x8e, 0xda, 0x92, 0x84, 0x60, 0x59, 0x3a, 0xb9, 0x08, 0x81, 0x35, 0xeb, 0x30, 0x77, 0x12, 0xc2, 0x30, 0x94, 0xbf, 0x3f, 0x25, 0xb4, 0xec, 0x5f, 0x40, 0x0a, 0xc1, 0xed, 0xa3, 0xe4, 0x0e, 0x52, 0x48, 0x18, 0xef, 0x4f, 0x0a, 0x2d, 0xfb, 0x17, 0x90, 0x22, 0xd5, 0xa5, 0x8b, 0x96, 0x2e, 0x55, 0xd9, 0xe5, 0xac, 0x94, 0xeb, 0x1e, 0x84, 0x2a, 0x09, 0x6e, 0x10, 0x8a, 0x36, 0x32, 0xb1, 0x61, 0x1d, 0xf9, 0x6c, 0xcf, 0x9b, 0x6b, 0x63, 0x6f, 0xb6, 0x24, 0xd2, 0x58, 0x44, 0xbe, 0x26, 0x2b, 0xb8, 0x88, 0x8b, 0x04, 0x6f, 0x06, 0x5f, 0xe6, 0xe5, 0xac, 0x5d, 0xd0, 0x76, 0x8a, 0xe4, 0x26, 0xf3, 0x95, 0x6b, 0x1b, 0xf5, 0x73, 0x30, 0xff, 0x1a, 0x10, 0xfa, 0x0c, 0xb8, 0xb3, 0xdc, 0x2b, 0x4f, 0x1b, 0x53, 0xbb, 0x11, 0x4c, 0x45, 0xe4, 0xcf, 0xa6, 0xf0, 0x64, 0xe4, 0x16, 0x60, 0x1d, 0x93, 0xc0, 0x96, 0x2b, 0xb1, 0xf1, 0x7c, 0xb2, 0xcb, 0x72, 0xe5, 0xcc, 0xdf, 0xa6, 0xa6, 0xc9, 0xc4, 0x19, 0xd5, 0x2e, 0xe8, 0x6c, 0x30, 0x08, 0x07, 0x83, 0x73, 0xfb, 0x74, 0x5e, 0x56, 0x01, 0xce, 0xc8, 0x68, 0x11, 0x64, 0xf0, 0x0c, 0x5a, 0x48, 0x1d, 0x43, 0x76, 0x70, 0x30, 0xf2, 0xca, 0xc2, 0x74, 0x14, 0x30, 0x05, 0x59, 0xc1, 0x8f, 0xe6, 0x55, 0xb9, 0x7c, 0xb5, 0x88, 0xab, 0x57, 0xe8, 0xd7, 0xe4, 0xfa, 0xb3, 0xec, 0x7c, 0xe4, 0x2c, 0xc8, 0xe6, 0x81, 0x44, 0x0d, 0xe9, 0xf3, 0x40, 0x01, 0xcc, 0x2a, 0x16, 0x5f, 0x29, 0xa3, 0x97, 0x43, 0x5a, 0x16, 0x6e, 0x87, 0xd1, 0xd6, 0x07, 0x92, 0x20, 0x84, 0xe1, 0xf1, 0xb0, 0x09, 0x03, 0x81, 0x1f, 0x1c, 0x1c, 0x7b, 0x63, 0x49, 0x59, 0x88, 0xac, 0xa8, 0x99, 0x4c, 0xa0, 0x28, 0x47, 0xa3, 0x7a, 0x95, 0xe4, 0x46, 0xcf, 0x1e, 0xf2, 0xe1, 0x19, 0xc2, 0x3b, 0x47, 0xff, 0x9e, 0xb4, 0xeb, 0xf8, 0x00, 0x67, 0x5e, 0x6c, 0x86, 0x85, 0x12, 0xb9, 0xcc, 0xe7, 0x3a, 0x8a, 0xe3, 0xaf, 0xf3, 0x39, 0x67, 0x58, 0x15, 0x56, 0x2b, 0xac, 0x17, 0xa7, 0x02, 0xb3, 0xf9, 0x85, 0xfb, 0xd9, 0xd5, 0x4a, 0x90, 0xb5, 0xef, 0xa6, 0x14, 0xcb, 0x42, 0xf3, 0x65, 0xa8, 0x11, 0x24, 0x63, 0xb5, 0x44, 0x07, 0xc9, 0x3e, 0x93, 0x7a, 0xea, 0xff, 0xb0, 0xaa, 0xd8, 0x3c, 0xfb, 0x8c, 0xd9, 0x3f, 0x36, 0x6c, 0xa9, 0xc4, 0xbb, 0x12, 0x54, 0xa8, 0xea, 0xaa, 0xef, 0x71, 0x07, 0xa6, 0x94, 0xfb, 0xeb, 0x8c, 0xad, 0x95, 0xd4, 0xbf, 0x8e, 0x45, 0xfc, 0xcf, 0x8c, 0xad, 0x09, 0xdd, 0x68, 0xd6, 0x94, 0x79, 0x43, 0x5a, 0xbb, 0x6c, 0x73, 0x4b, 0xb0, 0x1f, 0x36, 0x0e, 0x5b, 0x5d, 0x4a, 0xe0, 0xb6, 0x38, 0xef, 0x0f, 0xca, 0x18, 0x30, 0x07, 0xc5, 0x1e, 0x03, 0xef, 0xbe, 0x40, 0xdd, 0x3a, 0x34, 0x66, 0xfe, 0xd0, 0x39, 0xf3, 0xae, 0xbb, 0x05, 0x69, 0x5f, 0x22, 0xef, 0x50, 0x9e, 0x8e, 0x5c, 0x21, 0xdf, 0x8e, 0xba, 0x84, 0xa5, 0x71, 0xdb, 0x60, 0x58, 0x80, 0x49, 0x82, 0x73, 0xd9, 0xe0, 0x81, 0xef, 0x04, 0xd4, 0x7b, 0xa9, 0x4f, 0xf1, 0x53, 0xd3, 0x04, 0x93, 0x8a, 0xf6, 0x3a, 0x85, 0x47, 0x5d, 0x0e, 0x21, 0x84, 0x46, 0xce, 0x41, 0x57, 0xd6, 0xce, 0xbc, 0x6e, 0x60, 0xfa, 0x98, 0xee, 0x0b, 0xf0, 0xcf, 0xb9, 0x1d, 0x95, 0x21, 0x7b, 0x91, 0xa5, 0x8a, 0x25, 0xb7, 0xcf, 0x2f, 0x1a, 0x5b, 0xb8, 0x51, 0x02, 0x55, 0x11, 0x4c, 0x0b, 0x09, 0xa1, 0x23, 0xdb, 0x3e, 0x5e, 0xb3, 0x39, 0x45, 0x59, 0x65, 0x61, 0xc3, 0x35, 0x75, 0x73, 0xa8, 0xfa, 0x6f, 0x64, 0x0d, 0x12, 0x59, 0x7d, 0x4b, 0xb5, 0x10, 0xe1, 0xda, 0x8a, 0x1a, 0xc2, 0x64, 0x29, 0x0c, 0x15, 0x66, 0x43, 0xbf, 0x0a, 0xe8, 0xb4, 0xa9, 0xc8, 0x53, 0xed, 0xec, 0x51, 0x91, 0xda, 0x45, 0x18, 0xbc, 0x48, 0xe5, 0x25, 0xd1, 0x99, 0xb1, 0xdd, 0xbf, 0xd2, 0xec, 0xe8, 0x8a, 0x6d, 0x14, 0x6a, 0xd1, 0xbc, 0xac, 0xde, 0xc4, 0xc9, 0x22, 0x08, 0xae, 0xd8, 0xc6, 0x73, 0x9c, 0xe0, 0xc0, 0x90, 0xa5, 0x25, 0xaf, 0xfb, 0x85, 0x3a, 0x59, 0x71, 0xc6, 0xd9, 0x15, 0xdb, 0x9c, 0xdb, 0x4b, 0x46, 0x2b, 0xce, 0xaa, 0x22, 0x63, 0xa1, 0xb8, 0xb4, 0xa0, 0xa0, 0x15, 0x6c, 0xfd, 0x9a, 0xcd, 0xb1, 0x88, 0xd3, 0xe0, 0xa8, 0x53, 0x1a, 0x6c, 0x3c, 0x89, 0xb8, 0x57, 0x88, 0xcb, 0x8a, 0x79, 0x8e, 0x81, 0xb0, 0xce, 0x09, 0x3c, 0x16, 0x60, 0x9b, 0x69, 0x07, 0xf0, 0x88, 0xc3, 0x23, 0x78, 0xaa, 0x91, 0x34, 0x38, 0x58, 0xb2, 0x39, 0xf5, 0xaf, 0xb6, 0x97, 0x59, 0xc5, 0x77, 0x5a, 0x6f, 0x5b, 0xd3, 0x56, 0x9a, 0x0f, 0x6e, 0xff, 0x88, 0xdc, 0x25, 0x32, 0xeb, 0x5c, 0x51, 0x55, 0xcf, 0x50, 0x02, 0x7e, 0xd1, 0x8d, 0x0e, 0x17, 0x97, 0x4c, 0x3c, 0xb8, 0x69, 0xc1, 0x5e, 0x6e, 0x1f, 0xdc, 0x20, 0x55, 0xdb, 0x8b, 0xe3, 0xe6, 0xf2, 0x75, 0x95, 0x09, 0x66, 0xd7, 0xf3, 0x1d, 0xd7, 0xbb, 0x17, 0x93, 0x92, 0x6b, 0x99, 0xcc, 0xa3, 0x6f, 0xa8, 0x0d, 0x59, 0x8a, 0xb3, 0x6a, 0x43, 0x3d, 0x38, 0x08, 0xdb, 0x4d, 0xc7, 0xaa, 0x33, 0x58, 0x6a, 0x46, 0x14, 0x45, 0x8a, 0x9f, 0x6e, 0x03, 0x56, 0xa3, 0x1d, 0x8d, 0xb2, 0x4a, 0x39, 0x3f, 0x93, 0x19, 0xf8, 0xa8, 0x3d, 0x99, 0x26, 0xa9, 0xc7, 0x72, 0x9e, 0x69, 0x0a, 0x21, 0xa1, 0xc2, 0x11, 0xa3, 0x9e, 0xca, 0xac, 0xf1, 0xa0, 0x71, 0x3f, 0x43, 0x71, 0x14, 0x85, 0x19, 0x9e, 0x5e, 0x86, 0x10, 0x9c, 0x21, 0xd6, 0xea, 0xce, 0xe6, 0x9c, 0xa4, 0x3e, 0xb8, 0x01, 0x39, 0x16, 0x45, 0xb2, 0x1a, 0x09, 0xdb, 0xd1, 0xa8, 0xb9, 0x83, 0x42, 0x9b, 0xc2, 0x71, 0x34, 0x6b, 0xe8, 0x0e, 0x5c, 0xe5, 0x6f, 0xea, 0x26, 0x27, 0x82, 0x07, 0x9e, 0xc8, 0xe6, 0x65, 0x79, 0x55, 0xaf, 0xe4, 0xa4, 0xd9, 0xc6, 0x6d, 0xa0, 0xc6, 0x2c, 0x34, 0xe3, 0xef, 0xe2, 0x77, 0x4d, 0xa3, 0x61, 0x8c, 0xb8, 0xb9, 0x07, 0x97, 0x78, 0x1c, 0x1d, 0xb6, 0x42, 0xe8, 0x86, 0xdb, 0xa0, 0x9e, 0x96, 0xce, 0x43, 0xe8, 0xb0, 0x4d, 0x7a, 0x01, 0x91, 0xd7, 0x0c, 0x95, 0x5a, 0x86, 0x8b, 0xae, 0xa0, 0x31, 0x32, 0xa8, 0x8b, 0xab, 0xa2, 0x5c, 0x4b, 0x3d, 0x07, 0x49, 0x71, 0xdb, 0x80, 0xf9, 0x58, 0x3a, 0x67, 0xe4, 0x86, 0xdd, 0x7d, 0x6e, 0xab, 0x89, 0xfb, 0xa5, 0x12, 0xa0, 0xce, 0xeb, 0x75, 0x55, 0x36, 0xea, 0xb2, 0x91, 0x94, 0x45, 0x63, 0x00, 0x85, 0x4c, 0xf7, 0x0e, 0x45, 0x1b, 0xe0, 0x58, 0x2e, 0x22, 0x1d, 0x90, 0x8b, 0xda, 0xb6, 0xac, 0x69, 0x91, 0xf7, 0xef, 0xb2, 0xf9, 0xed, 0x43, 0x67, 0x45, 0xbd, 0x84, 0x2c, 0x75, 0x0c, 0x44, 0x8b, 0xe7, 0x3b, 0xf2, 0x3b, 0xeb, 0x70, 0x16, 0x96, 0x8d, 0x2d, 0x1e, 0x7b, 0xb7, 0x49, 0x1e, 0xde, 0x1e, 0x4f, 0xb5, 0xcc, 0xbf, 0xc1, 0xdc, 0xc1, 0x46, 0x0c, 0xde, 0xd5, 0xe1, 0x0e, 0x35, 0x37, 0xad, 0x13, 0x54, 0xad, 0xe9, 0xb0, 0x7d, 0x2a, 0x0e, 0x34, 0xc7, 0x2c, 0xe3, 0x9a, 0x57, 0x79, 0xc6, 0x0a, 0x57, 0xdd, 0x9a, 0x15, 0x4b, 0xb8, 0x6e, 0x3a, 0x12, 0xf9, 0xca, 0x83, 0xea, 0x3d, 0xa4, 0xdd, 0xe4, 0x88, 0xad, 0x92, 0x95, 0xb3, 0x8f, 0xea, 0x5d, 0x11, 0xf0, 0x2f, 0x57, 0x6e, 0x74, 0xdf, 0x80, 0x35, 0x08, 0xa1, 0xf3, 0xfe, 0xc1, 0x16, 0xaf, 0x5d, 0x24, 0x30, 0x8b, 0x37, 0x59, 0x74, 0x6c, 0x69, 0x40, 0xe1, 0xaa, 0x0b, 0xe5, 0xb5, 0x1b, 0xe1, 0x87, 0x4d, 0x22, 0xea, 0x02, 0x27, 0xa7, 0xf6, 0x55, 0x87, 0x55, 0x9c, 0xe2, 0x49, 0x36, 0x0e, 0xcb, 0x72, 0x43, 0xda, 0x9f, 0x7d, 0x17, 0x38, 0x9c, 0xa8, 0xd1, 0x89, 0xe1, 0x76, 0xe3, 0x70, 0x5c, 0x77, 0x63, 0xf1, 0x57, 0x12, 0x8f, 0x95, 0xa2, 0x21, 0x76, 0xf2, 0x7b, 0x29, 0x50, 0x39, 0xfb, 0x48, 0x86, 0x10, 0x53, 0x11, 0xc7, 0x56, 0xde, 0x40, 0xae, 0x6e, 0xc6, 0x1d, 0x3e, 0x84, 0x20, 0x2b, 0xcd, 0xd7, 0x77, 0x99, 0x1c, 0x17, 0xe8, 0x75, 0x43, 0x41, 0x3d, 0x13, 0x5e, 0xce, 0x3e, 0x1a, 0x59, 0xf3, 0x23, 0x5a, 0x19, 0xcc, 0xde, 0x47, 0xda, 0x1c, 0x65, 0x54, 0x13, 0x6f, 0x09, 0xb9, 0xba, 0x35, 0xa9, 0x27, 0xe6, 0xf2, 0xc4, 0x4b, 0xc7, 0x51, 0x77, 0x09, 0xb6, 0xf7, 0x62, 0x0d, 0xd5, 0x11, 0x9c, 0xe2, 0xb2, 0x85, 0xe6, 0xca, 0xde, 0x04, 0x86, 0x74, 0xc0, 0x43, 0xd8, 0x9e, 0xbb, 0x47, 0xd9, 0x4e, 0xf6, 0x9f, 0x5b, 0x29, 0xc7, 0x48, 0x65, 0xd4, 0x30, 0xf7, 0xed, 0x05, 0x7f, 0xf3, 0x17, 0x90, 0x60, 0x1d, 0xfa, 0xf6, 0xbd, 0xc9, 0xa3, 0xc1, 0xdb, 0xe2, 0x3a, 0xce, 0xb3, 0x54, 0xbd, 0xbf, 0xa3, 0x7b, 0x3b, 0x70, 0x35, 0xea, 0x0e, 0x19, 0xd1, 0x41, 0xd8, 0x99, 0x6f, 0x48, 0xf2, 0xce, 0x0e, 0xcf, 0x23, 0x2b, 0x3d, 0xd3, 0x76, 0x79, 0x00, 0xc6, 0x3e, 0x56, 0x77, 0x76, 0x4a, 0x8d, 0xc7, 0xea, 0xcd, 0xa4, 0x5e, 0x7e, 0x76, 0x2a, 0xbf, 0x3d, 0xc5, 0xce, 0x7c, 0xd3, 0xcd, 0x9b, 0x3c, 0x3b, 0x01, 0xe3, 0xf1, 0x8d, 0x6e, 0x06, 0xaf, 0x2b, 0x15, 0xe1, 0xf8, 0x61, 0x4d, 0x1e, 0x6f, 0xca, 0x5a, 0xfc, 0x44, 0x9b, 0x05, 0x72, 0xcf, 0x10, 0xe3, 0x08, 0xd7, 0xa0, 0x18, 0x1e, 0x84, 0x32, 0x1c, 0xdd, 0x86, 0x50, 0x52, 0x3a, 0x4e, 0xbf, 0x55, 0x66, 0xde, 0xae, 0xcb, 0xed, 0x74, 0xa1, 0x41, 0xa7, 0x8d, 0x40, 0xf7, 0xfb, 0xcc, 0x90, 0x67, 0x0b, 0xfc, 0x13, 0x77, 0xd5, 0xf4, 0xec, 0xdc, 0x75, 0xd2, 0x64, 0x1c, 0x1b, 0xd5, 0x1d, 0x03, 0xa4, 0xa3, 0xaa, 0xe3, 0xc0, 0x72, 0xd2, 0x84, 0x3e, 0x63, 0x2e, 0x1f, 0xa2, 0xb7, 0x7d, 0x99, 0x09, 0x1e, 0xe0, 0xa1, 0x68, 0x96, 0x60, 0x58, 0x0e, 0x07, 0x90, 0xc1, 0x23, 0xe2, 0x55, 0xa8, 0xfe, 0x6b, 0x34, 0x7a, 0xd4, 0x13, 0x4b, 0x6c, 0xdb, 0xc9, 0xb2, 0x4b, 0xdd, 0x5f, 0x44, 0xc7, 0x1c, 0x53, 0x1b, 0x9f, 0x8e, 0x66, 0x4d, 0xdb, 0x4c, 0xd0, 0xc9, 0xf7, 0x3e, 0xae, 0xdf, 0x97, 0xe7, 0xa5, 0x2e, 0x10, 0x49, 0xfc, 0x2f, 0xb1, 0x12, 0x1a, 0x0b, 0xa6, 0x2d, 0x9b, 0x92, 0xeb, 0x10, 0x5c, 0x7a, 0x42, 0xdc, 0x3d, 0xf4, 0xa4, 0x93, 0x02, 0xd8, 0x2e, 0x25, 0xf6, 0x0c, 0x9c, 0x71, 0x75, 0xc6, 0x83, 0x40, 0x0f, 0xab, 0xad, 0x20, 0x7c, 0x2c, 0xb3, 0x22, 0x18, 0x76, 0xf6, 0xb3, 0x36, 0x4f, 0xeb, 0xaf, 0x90, 0xd0, 0x57, 0x0e, 0xdf, 0xc1, 0x40, 0xb3, 0xcf, 0xa2, 0x8a, 0x13, 0x79, 0x3b, 0x6d, 0x8d, 0x35, 0xd9, 0xe0, 0xc8, 0x0f, 0x37, 0xca, 0xd9, 0x47, 0x99, 0x12, 0x68, 0x8b, 0xd2, 0xe9, 0xc5, 0x54, 0x83, 0x0a, 0x4a, 0x19, 0xc4, 0xda, 0x62, 0x96, 0x73, 0x52, 0x68, 0x96, 0xd4, 0x04, 0x5d, 0xdf, 0x82, 0x67, 0x85, 0x28, 0x21, 0x2e, 0xe4, 0x11, 0x1b, 0xf7, 0xd7, 0x28, 0x1b, 0xdd, 0xdf, 0x0b, 0xda, 0x89, 0x5c, 0x5a, 0x5d, 0xdf, 0xee, 0xeb, 0x9b, 0xad, 0xef, 0x92, 0x38, 0x4f, 0x6a, 0xcc, 0x9b, 0x51, 0xba, 0x82, 0x86, 0xd9, 0xf4, 0xe0, 0x68, 0x84, 0xad, 0xb4, 0x1a, 0x49, 0x35, 0x22, 0x78, 0x78, 0xac, 0xff, 0x3e, 0x90, 0xfb, 0x3e, 0xeb, 0x30, 0xf7, 0x76, 0xce, 0x14, 0x7c, 0xaf, 0xa5, 0xb6, 0x70, 0x4c, 0x87, 0x13, 0x0c, 0xbc, 0xd5, 0x19, 0xa0, 0x57, 0x3f, 0x33, 0xc2, 0xe0, 0x6e, 0x6b, 0xcc, 0x83, 0x17, 0xe3, 0x2a, 0xe8, 0x6e, 0x3f, 0x48, 0x53, 0xd2, 0x60, 0xc1, 0xf2, 0x15, 0x55, 0x76, 0xff, 0x84, 0x10, 0x5e, 0xc7, 0xd5, 0x3b, 0x52, 0xa5, 0x8c, 0x53, 0x04, 0x05, 0x53, 0x99, 0x17, 0x7f, 0xf3, 0x58, 0x19, 0x59, 0x6e, 0xde, 0x83, 0x30, 0x13, 0x6d, 0xd1, 0xe0, 0xd8, 0x99, 0x27, 0x23, 0xc5, 0x3b, 0x2c, 0x1f, 0x92, 0x74, 0x26, 0x21, 0x9e, 0x1b, 0x8e, 0x92, 0x41, 0xf0, 0x1c, 0x8c, 0xa2, 0xab, 0x69, 0xc4, 0x14, 0xdd, 0xca, 0xe2, 0xd3, 0x86, 0xbb, 0x04, 0x86, 0x7a, 0x99, 0x0e, 0x72, 0x9b, 0x4b, 0xac, 0x90, 0x74, 0x04, 0x07, 0x0d, 0xcb, 0x81, 0x94, 0xf2, 0x7a, 0x66, 0xee, 0x5e, 0x6e, 0x17, 0x91, 0x4e, 0xc9, 0x6f, 0xd7, 0x44, 0x95, 0x0e, 0xd8, 0xaa, 0xa4, 0x0c, 0xca, 0x5d, 0x86, 0x7a, 0xb1, 0xaa, 0x41, 0xe0, 0xff, 0x04, 0xd3, 0x0c, 0x36, 0xae, 0xe6, 0xb5, 0x95, 0x42, 0x2e, 0x30, 0x3a, 0xd1, 0x6e, 0x69, 0x50, 0x08, 0x74, 0xc6, 0xbe, 0xdf, 0x4c, 0xa2, 0xbf, 0x61, 0x90, 0x2c, 0x93, 0x17, 0xc5, 0xf5, 0x40, 0x76, 0x65, 0x38, 0x4c, 0xec, 0x0e, 0x49, 0xe9, 0x8e, 0x2e, 0x77, 0x78, 0x64, 0x39, 0xaa, 0x1a, 0x7c, 0x6e, 0xf4, 0xfb, 0xe4, 0xf4, 0x7b, 0xeb, 0x72, 0xf2, 0xbe, 0xa1, 0x69, 0x9f, 0xa4, 0x79, 0x2e, 0xa5, 0xd5, 0xce, 0xf1, 0xc2, 0xb9, 0x41, 0xec, 0x12, 0x60, 0x5f, 0x5a, 0x77, 0x0a, 0x72, 0xff, 0x15, 0xa1, 0x2b, 0xbd, 0xc7, 0xaf, 0xdb, 0x57, 0x76, 0x89, 0x4b, 0xef, 0x11, 0xe4, 0xde, 0x1a, 0xc4, 0xde, 0x3f, 0x54, 0x55, 0x37, 0x11, 0x58, 0x2c, 0xbd, 0x6f, 0xfc, 0xa9, 0x83, 0x45, 0xa9, 0x2e, 0x2d, 0x7b, 0x8a, 0x67, 0x2f, 0x83, 0x1f, 0xbc, 0xc4, 0xdc, 0x3d, 0x54, 0xdd, 0x01, 0xa3, 0xde, 0x10, 0x74, 0x67, 0x94, 0xfe, 0x4c, 0xac, 0xfa, 0x8d, 0x62, 0x52, 0xea, 0x1d, 0xeb, 0xf7, 0xa5, 0x1d, 0xcc, 0xeb, 0x8d, 0x4b, 0xef, 0x08, 0x1d, 0xef, 0xb9, 0x53, 0x4f, 0x53, 0x88, 0xb2, 0x91, 0x12, 0x46, 0x57, 0xdc, 0xa0, 0xb7, 0xe9, 0x88, 0x1b, 0x76, 0xc2, 0x40, 0xda, 0xfd, 0xff, 0x9d, 0xf8, 0xc0, 0xb9, 0x15, 0xd0, 0xd4, 0x76, 0xfb, 0xfd, 0xdb, 0xc4, 0x48, 0x22, 0xdc, 0x38, 0x95, 0xbf, 0xe2, 0xa9, 0xdb, 0x8d, 0x74, 0xbe, 0x2f, 0xec, 0x7e, 0xf7, 0x8f, 0xae, 0x04, 0x1a, 0x8f, 0xac, 0xfb, 0xd5, 0x5c, 0xee, 0x40, 0xf0, 0xcf, 0x79, 0x45, 0xd3, 0xd3, 0x67, 0xf9, 0x81, 0x47, 0x7d, 0x2b, 0x8f, 0x9c, 0xbb, 0x00, 0x15, 0x32, 0x74, 0x5b, 0x40, 0x5d, 0xc7, 0x74, 0x93, 0x8a, 0x7b, 0x49, 0x03, 0x5f, 0x67, 0xd8, 0xc1, 0xed, 0xe7, 0x68, 0x4e, 0x61, 0x35, 0xe6, 0xcc, 0x7c, 0x44, 0xc1, 0x68, 0x8b, 0xda, 0x95, 0x2e, 0x11, 0xe8, 0xfb, 0x08, 0x12, 0xc9, 0x48, 0x94, 0x3f, 0xe1, 0x4d, 0x7e, 0xf0, 0xa3, 0x6a, 0x65, 0xac, 0xca, 0xba, 0xa0, 0xae, 0xe1, 0xef, 0x9f, 0xa0, 0xbd, 0x01, 0x82, 0x83, 0x17, 0xfe, 0x49, 0xc6, 0x65, 0xdb, 0xb4, 0xdd, 0x43, 0x7e, 0x79, 0xa4, 0xb9, 0x85, 0x24, 0xfe, 0x04, 0x8e, 0x60, 0x62, 0x9b, 0x4a, 0xe4, 0x02, 0xf9, 0x39, 0x91, 0xce, 0x05, 0x51, 0xa2, 0x9a, 0x41, 0x5e, 0x88, 0xc0, 0xd6, 0x7c, 0xd5, 0x67, 0x5c, 0xba, 0x97, 0x58, 0xe6, 0x91, 0x77, 0x36, 0x19, 0x98, 0x7f, 0x66, 0x7d, 0x11, 0xf0, 0xff, 0x9f, 0x99, 0xb3, 0xc5, 0xfe, 0xbe, 0x17, 0x5c, 0x76, 0x9e, 0x96, 0xcf, 0xa4, 0x46, 0x0d, 0x51, 0xc1, 0x19, 0x0e, 0xbb, 0x0a, 0x0a, 0xea, 0x61, 0x57, 0xe7, 0x8f, 0xaf, 0xfb, 0xbb, 0x1f, 0xb7, 0x6a, 0xef, 0x74, 0x03, 0x22, 0xfd, 0xf1, 0x22, 0xf5, 0xbd, 0xa1, 0xce, 0x68, 0x89, 0x42, 0xd9, 0xc6, 0x45, 0x61, 0x6f, 0x50, 0x34, 0x72, 0xcd, 0x81, 0xfb, 0x1c, 0xd6, 0x71, 0x7e, 0x25, 0x5f, 0x9c, 0x50, 0x9f, 0x24, 0x52, 0x5b, 0xcb, 0x49, 0xf4, 0x36, 0x05, 0xfa, 0x88, 0x64, 0x26, 0x21, 0x85, 0x80, 0xb6, 0xe7, 0xd7, 0x76, 0xfc, 0x84, 0x5e, 0x96, 0x3e, 0x72, 0x24, 0xef, 0x08, 0x68, 0x72, 0x24, 0xf7, 0x7b, 0xa9, 0xee, 0x0b, 0x38, 0xcc, 0xcb, 0x3c, 0x2f, 0xd7, 0x70, 0x99, 0x24, 0x43, 0xf3, 0x09, 0xa4, 0x3c, 0x13, 0x22, 0x67, 0xc0, 0x8a, 0x34, 0x8b, 0x0b, 0xa8, 0xea, 0x9c, 0x9a, 0xf8, 0x9d, 0x62, 0xc3, 0xcc, 0x2c, 0xe7, 0x0b, 0x7c, 0x1f, 0x00, 0x11, 0xe0, 0xb2, 0x0b, 0x06, 0x31, 0xc3, 0x33, 0x40, 0xfc, 0x15, 0x6d, 0x2c, 0xa6, 0xb2, 0xc1, 0x65, 0x91, 0xcd, 0xb3, 0x24, 0x2e, 0xe8, 0xf6, 0x3c, 0x84, 0xb8, 0xd8, 0x40, 0x29, 0x16, 0xac, 0x92, 0x88, 0xc9, 0xd5, 0x5c, 0xbf, 0x30, 0x44, 0x7d, 0x3e, 0xeb, 0x45, 0x99, 0x4b, 0xe0, 0xd4, 0xfb, 0x33, 0x9c, 0x1c, 0x0e, 0x21, 0xce, 0xb3, 0xcb, 0x82, 0xa3, 0x38, 0x62, 0x18, 0x28, 0x2f, 0x06, 0xb3, 0x2f, 0x54, 0x57, 0xe9, 0xe2, 0x32, 0x1d, 0x49, 0x28, 0x5b, 0x45, 0xdc, 0xc6, 0xee, 0x66, 0x99, 0x01, 0xc3, 0x4c, 0xdc, 0x47, 0x8d, 0xe1, 0x15, 0x1f, 0x76, 0xd4, 0xd7, 0x55, 0x85, 0x6f, 0x5e, 0x48, 0x0c, 0xb1, 0x93, 0x5a, 0xdf, 0xb3, 0x54, 0x75, 0x61, 0xe3, 0x6a, 0xcd, 0x72, 0x0b, 0x0a, 0x71, 0xab, 0x39, 0x7d, 0x77, 0xc7, 0x03, 0xd4, 0x5a, 0xaf, 0x7a, 0x25, 0xb1, 0x73, 0xf1, 0xf7, 0xba, 0x80, 0xa9, 0xba, 0x0a, 0x31, 0xef, 0xf0, 0x1a, 0x4f, 0xf3, 0x4b, 0x2c, 0x16, 0x51, 0xc2, 0xb2, 0x3c, 0xb0, 0xdb, 0x8d, 0xe1, 0xa9, 0x11, 0x6e, 0x1f, 0x09, 0x29, 0xcc, 0xaa, 0xac, 0x42, 0x8c, 0xb0, 0xcd, 0x18, 0xf4, 0xbb, 0xa3, 0x30, 0x7c, 0x47, 0x88, 0x8e, 0xe5, 0x07, 0x5c, 0xd9, 0x2a, 0x11, 0x7b, 0x46, 0x0d, 0x2b, 0x41, 0x9d, 0x21, 0xdf, 0x78, 0xec, 0x1e, 0xa7, 0x12, 0x5c, 0x25, 0x6f, 0x68, 0x55, 0x68, 0x91, 0x7c, 0xbb, 0x44, 0x1e, 0x78, 0x2e, 0xbf, 0x8d, 0x23, 0xca, 0xd2, 0xc0, 0xd0, 0x6c, 0xf2, 0x5e, 0xd0, 0xa7, 0xde, 0x1e, 0xaa, 0x23, 0xfa, 0xb7, 0x5a, 0xb2, 0xe3, 0x47, 0x6d, 0xa4, 0x83, 0x91, 0xc3, 0x46, 0xf0, 0x7f, 0x7b, 0x2e, 0xd1, 0xcd, 0x7f, 0xb9, 0xe8, 0x91, 0x4b, 0xa6, 0x7b, 0x10, 0xd0, 0x78, 0xfd, 0xc1, 0x37, 0x56, 0xfa, 0x95, 0x04, 0x95, 0x28, 0x76, 0x24, 0x6f, 0xb7, 0xd6, 0xd3, 0x7a, 0xab, 0x0a, 0x76, 0x2f, 0x8b, 0xb2, 0xcd, 0x48, 0x4f, 0xec, 0x9e, 0x0e, 0xde, 0x30, 0x31, 0xc3, 0xc7, 0x7b, 0xdd, 0xa8, 0x6f, 0xbb, 0x0e, 0xfb, 0xb0, 0x71, 0xae, 0x5f, 0x58, 0x55, 0xca, 0xcf, 0xa5, 0x59, 0xf9, 0xd6, 0x6a, 0xaa, 0x55, 0x59, 0x8e, 0xaa, 0x57, 0x4b, 0x53, 0x96, 0xe4, 0x71, 0x85, 0x87, 0xeb, 0x7e, 0x09, 0x4e, 0x4a, 0x61, 0x5d, 0x64, 0xe2, 0xa5, 0xec, 0xae, 0xe9, 0x63, 0x8e, 0xd3, 0x62, 0xa3, 0x57, 0xad, 0x4a, 0x9e, 0xc9, 0x6f, 0x06, 0xf5, 0xa4, 0x37, 0x2d, 0xfe, 0xb8, 0x27, 0x6a, 0x56, 0x8f, 0xcd, 0xf6, 0x23, 0x78, 0x64, 0x51, 0x19, 0xbb, 0x1b, 0x76, 0x28, 0x5a, 0x3f, 0xdf, 0xee, 0x27, 0x9d, 0xd6, 0x76, 0xb7, 0xb5, 0xfa, 0x60, 0x4a, 0x7a, 0x78, 0xec, 0x25, 0x14, 0x4d, 0x85, 0xe8, 0x0d, 0x37, 0xf5, 0x2d, 0x44, 0xc3, 0xb4, 0xcf, 0xe8, 0xbb, 0x00, 0xf2, 0xfd, 0x0c, 0xfc, 0xfb, 0x10, 0x5f, 0x1c, 0xa2, 0xb7, 0x83, 0xbb, 0x6c, 0xb6, 0xb6, 0x8a, 0xf2, 0x45, 0x3f, 0xd4, 0x52, 0x34, 0xba, 0x8d, 0x0b, 0x8e, 0x59, 0x26, 0x7e, 0x53, 0xec, 0x6c, 0xdd, 0x6a, 0x38, 0xb6, 0x57, 0x97, 0xbd, 0x0e, 0x8b, 0x46, 0xed, 0xd7, 0xed, 0xfb, 0x45, 0x7a, 0xfd, 0x64, 0x50, 0x9d, 0x36, 0x4c, 0xdd, 0x7d, 0x30, 0xb1, 0x76, 0xad, 0x52, 0xe0, 0x76, 0x57, 0x3e, 0x0d, 0x56, 0xf0, 0xfc, 0x39, 0xbe, 0xcb, 0xf0, 0xfc, 0x39, 0x04, 0x2b, 0x78, 0x08, 0xff, 0x36, 0x1a, 0xc1, 0x43, 0x38, 0x72, 0x85, 0x58, 0x62, 0xf3, 0x75, 0x0a, 0x47, 0x05, 0x3c, 0x7b, 0x06, 0xf2, 0x3b, 0x5a, 0x41, 0xd6, 0xd3, 0x04, 0x02, 0xc1, 0xf8, 0xbf, 0xb0, 0xa7, 0xe1, 0x65, 0x76, 0x39, 0x3a, 0x79, 0x5b, 0x88, 0x71, 0x24, 0x18, 0x17, 0x36, 0xf8, 0xb2, 0x95, 0xd3, 0x11, 0x9e, 0xb3, 0x04, 0xfe, 0xfc, 0xb9, 0x06, 0x4b, 0x7a, 0xf4, 0x18, 0x8e, 0x9c, 0x3a, 0x92, 0x9c, 0xf2, 0xb8, 0xb1, 0x3f, 0x4e, 0x54, 0x2f, 0x5b, 0x66, 0x97, 0x05, 0xde, 0x2a, 0x30, 0xd5, 0x66, 0xed, 0x25, 0x17, 0xe3, 0x97, 0xd9, 0xe5, 0x6d, 0x28, 0xd8, 0xeb, 0xfd, 0x77, 0xd4, 0x2e, 0xeb, 0x44, 0x45, 0x5a, 0x3c, 0x4c, 0x89, 0xa0, 0x43, 0x3e, 0xe8, 0x59, 0xa5, 0x5f, 0x42, 0x27, 0x03, 0x2d, 0xaa, 0xba, 0x48, 0xf0, 0x5d, 0x3a, 0x72, 0xc3, 0x85, 0x60, 0x97, 0xac, 0xe2, 0xe4, 0xa2, 0x51, 0x3c, 0xfc, 0xcf, 0x2e, 0xd2, 0x2b, 0x8e, 0x8d, 0x0a, 0xc4, 0x2d, 0x32, 0x12, 0x5a, 0xc9, 0xd0, 0xec, 0xd1, 0x03, 0x92, 0x2b, 0x51, 0xcc, 0xf1, 0x58, 0xdf, 0x05, 0x76, 0x5d, 0x39, 0x07, 0x1b, 0x39, 0x0e, 0x66, 0xd9, 0x25, 0x7e, 0xd3, 0xcc, 0x21, 0x5b, 0xb1, 0x93, 0xf4, 0x9d, 0x50, 0x0f, 0x3c, 0x46, 0xc8, 0x8f, 0x3d, 0xe9, 0x32, 0xc6, 0xb7, 0x12, 0x44, 0xd5, 0x27, 0x88, 0xae, 0x6c, 0x0a, 0x9d, 0x02, 0xe9, 0xcf, 0x5c, 0xc6, 0xfc, 0x0a, 0xf0, 0x95, 0xbc, 0x67, 0xcf, 0xb4, 0x98, 0xba, 0x69, 0x35, 0x66, 0xa8, 0xee, 0xea, 0x50, 0x47, 0xcb, 0x56, 0xae, 0x32, 0x29, 0xd7, 0x05, 0x9c, 0xc8, 0x6d, 0xbf, 0x4a, 0x98, 0x13, 0xf9, 0xeb, 0x21, 0xfc, 0x37, 0xfe, 0x6c, 0x7e, 0x50, 0xac, 0xf5, 0x71, 0x1c, 0xb7, 0x48, 0x7b, 0xdb, 0xf7, 0x6a, 0x90, 0xd7, 0xde, 0x75, 0x84, 0x91, 0xc7, 0xc3, 0xcf, 0xf3, 0xf9, 0x7c, 0xde, 0xbc, 0x22, 0xe7, 0xf5, 0xf2, 0xc8, 0x5a, 0x4c, 0x35, 0xf2, 0xc4, 0x8e, 0x18, 0xbe, 0xab, 0x30, 0xcc, 0xab, 0x16, 0x83, 0x5e, 0x1e, 0xd0, 0xff, 0x0f, 0x68, 0xd2, 0x08, 0xfe, 0x06, 0x4f, 0xfe, 0xfe, 0xf7, 0x63, 0x3b, 0xe3, 0x89, 0x9a, 0xf1, 0x04, 0xef, 0x6d, 0xea, 0xe5, 0x91, 0x37, 0xc3, 0xd3, 0x19, 0x39, 0xeb, 0xd9, 0x33, 0x78, 0x3a, 0x82, 0xaf, 0x34, 0x57, 0xaa, 0xc3, 0x76, 0x0f, 0xb5, 0xad, 0x84, 0x35, 0xbe, 0xb4, 0x5c, 0x60, 0x08, 0xa7, 0x3f, 0x06, 0x2a, 0x16, 0xf4, 0xd2, 0x69, 0x56, 0xb1, 0x3d, 0x25, 0x73, 0xcb, 0x32, 0xad, 0x73, 0xd6, 0xfc, 0x4a, 0x9d, 0x1c, 0x8d, 0xd8, 0xe7, 0x55, 0x59, 0x91, 0x17, 0x6b, 0x7c, 0xf3, 0x73, 0xa2, 0x5a, 0xa6, 0xf6, 0xfe, 0x07, 0xe0, 0x0a, 0x4d, 0xf1, 0x7d, 0x56, 0x00, 0x00 };
 const AsyncBufferStaticFile FILE_MODELS_JS = {FILE_MODELS_JS_URL, FILE_MODELS_JS_CONTENT_TYPE, FILE_MODELS_JS_ETAG, FILE_MODELS_JS_BODY, sizeof(FILE_MODELS_JS_BODY), FILE_MODELS_JS_GZIP};
 
 AsyncBufferStaticFile staticFiles[] = {
@@ -40,6 +40,8 @@ uint32_t _streamClientId = 0;
 uint8_t fps = 1; // 1 frame per second
 int test_int = 0;
 int test_int_array[10000] = {0};
+int test_history[101] = {0}; // last 100 frames, one slot is reserved for the push in progress
+AsyncBufferRing history(AsyncBufferType::INT, (uint8_t *)test_history, sizeof(test_history[0]), sizeof(test_history) / sizeof(test_history[0]));
 unsigned long nextFrame = 0;
 int frame = 0;
 
@@ -85,6 +87,8 @@ void setup() {
   server.onBuffer("/api/ints", AsyncBufferType::INT, (uint8_t *)&test_int_array, sizeof(test_int_array));
   server.onBuffer("/api/settings", AsyncBufferType::SETTINGS, (uint8_t *)&settings, sizeof(settings));
   server.onBuffer("/api/all-types", AsyncBufferType::ALLTYPES, (uint8_t *)&allTypes, sizeof(allTypes));
+  // GET only the history records added since the ?since=seq query parameter
+  server.onBufferRing("/api/history", &history);
 
   // CORS only needed for STA mode
   server.disableCORS(); // useful for local development
@@ -100,6 +104,7 @@ void setup() {
     Serial.printf("%s test_int_array\n", status == AsyncWebSocketBufferStatus::SET ? "SET" : "GET");
     return true; // send response?
   });
+  ws.onBufferRing("history", &history);
   ws.onBuffer("fps", AsyncBufferType::UINT8_T, [](AsyncWebSocketClientBuffer *client, String command, AsyncBufferType type, uint8_t *data, size_t len, AsyncWebSocketBufferStatus status) {
     // validate fps value before setting
     if(status == AsyncWebSocketBufferStatus::SET) {
@@ -118,7 +123,7 @@ void setup() {
     return false; // send response?
   });
   ws.onBuffer("help", [](AsyncWebSocketClientBuffer *client, String command, AsyncBufferType type, uint8_t *data, size_t len, AsyncWebSocketBufferStatus status) {
-    String msg = "Command List:\n\nsettings [Settings Object]\nstream [int fps]\nfps [int]\ntest_int_array [int array]\nclose\nhelp";
+    String msg = "Command List:\n\nsettings [Settings Object]\nstream [int fps]\nfps [int]\ntest_int_array [int array]\nhistory [uint32_t since]\nclose\nhelp";
     client->sendBuffer("help", AsyncBufferType::CHAR, (uint8_t *)msg.c_str(), msg.length());
     return false; // send response?
   });
@@ -161,6 +166,7 @@ void loop() {
   }
   frame++;
   nextFrame = now + (1000000.0F / (float)(fps));
+  history.push((uint8_t *)&frame);
   
   if(_streamClientId) {
     // You could provide a list of client IDs that have requested the data stream
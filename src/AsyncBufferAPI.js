@@ -11,6 +11,7 @@
           type: "", // primitive type or struct type
           name: "",  // parameter name
           arraySize: 0, // array size
+          bits: 0, // bitfield width, with arraySize each element is packed to this width
           value: 0 // default value
         }
       ] 
@@ -19,6 +20,8 @@
 class AsyncBufferAPI {
   #typeHeader = "X-Type";
   #checksumHeader = "X-Checksum";
+  #seqHeader = "X-Seq";
+  #seqStartHeader = "X-Seq-Start";
   #idIndex = 0;
   #primitiveTypes = {
     "bool": { s: 1, m: "Uint", p: true },
@@ -100,7 +103,17 @@ class AsyncBufferAPI {
         }
       }
       type = this.getType(response.headers.get(this.#typeHeader));
-      output = this.decode(type.id, buffer);
+      if(response.headers.has(this.#seqHeader)) {
+        // ring buffer response
+        output = {
+          start: parseInt(response.headers.get(this.#seqStartHeader), 10),
+          seq: parseInt(response.headers.get(this.#seqHeader), 10),
+          records: this.decodeRecords(type.id, buffer)
+        };
+      }
+      else {
+        output = this.decode(type.id, buffer);
+      }
     }
     else {
       output = await response.text();
@@ -116,13 +129,61 @@ class AsyncBufferAPI {
   async post(url, type, data = null, options = {}) { return await this.fetch('POST', url, type, data, options); };
   async delete(url, type, data = null, options = {}) { return await this.fetch('DELETE', url, type, data, options); };
 
+  // Ring buffer series section
+  // series = { seq: next sequence number to fetch or null before the first fetch, values: records oldest first, missed: records lost by falling behind, maxLength: 0 unlimited }
+  createSeries(maxLength = 0) {
+    return { seq: null, values: [], missed: 0, maxLength };
+  }
+  // fetch only the records added since the last call and append them to the series
+  async getSeries(url, series, options = {}) {
+    const separator = url.indexOf('?') === -1 ? '?' : '&';
+    const [output, response, type] = await this.fetch('GET', `${url}${separator}since=${series.seq ?? 0}`, null, null, options);
+    if (response.ok && response.headers.has(this.#seqHeader)) {
+      this.appendSeries(series, output);
+    }
+    else if (response.ok) {
+      throw new Error(`'${url}' is not a ring buffer route, missing ${this.#seqHeader} header`);
+    }
+    return [series, response, type];
+  }
+  appendSeries(series, { start, seq, records }) {
+    // on the first fetch whatever history the device already dropped was never missed
+    const synced = series.seq !== null;
+    if (synced && start < series.seq) {
+      // device sequence restarted, drop the stale history
+      series.values = [];
+    }
+    else if (synced && start > series.seq) {
+      // fell behind, the ring wrapped past our cursor
+      series.missed += start - series.seq;
+    }
+    for (const record of records) {
+      series.values.push(record); // spreading a large first fetch overflows the call stack
+    }
+    if (series.maxLength && series.values.length > series.maxLength) {
+      series.values.splice(0, series.values.length - series.maxLength);
+    }
+    series.seq = seq;
+    return series;
+  }
+
   // // WebSockets API section
   ws = null;
   #wsCommand = new Map();
+  #wsSeries = new Map();
   // register event listener on path
   on(command, cb) {
     this.#wsCommand.set(command, cb);
   }
+  // register a ring buffer listener, received records are appended to series
+  onSeries(command, series, cb) {
+    this.#wsSeries.set(command, series);
+    this.on(command, cb);
+  }
+  // request the records added since the series was last updated
+  sendSeries(command) {
+    this.send(command, "uint32_t", this.#wsSeries.get(command).seq ?? 0);
+  }
   // send message on path
   send(command, type = null, data = null, retry = 3) {
     this.open(); // make sure the connection is open.
@@ -208,7 +269,18 @@ class AsyncBufferAPI {
         [command, type] = header;
         let bodyOffset = command.length + type.length + hIdx;
         body = buffer.slice(bodyOffset);
-        body = api.decode(type, body.buffer);
+        if(this.#wsSeries.has(command)) {
+          // ring buffer response prefixed with the start and next sequence numbers
+          const view = new DataView(body.buffer);
+          body = this.appendSeries(this.#wsSeries.get(command), {
+            start: view.getUint32(0, true),
+            seq: view.getUint32(4, true),
+            records: this.decodeRecords(type, body.buffer.slice(8))
+          });
+        }
+        else {
+          body = api.decode(type, body.buffer);
+        }
         type = this.getType(type).name;
       }
       let cb = this.#wsCommand.get('*');
@@ -294,6 +366,9 @@ class AsyncBufferAPI {
     let fields = typeInfo.fields;
     let obj = {};
     for (const { type, name, value, arraySize } of fields) {
+      if (name === undefined) {
+        continue; // unnamed bitfield padding
+      }
       const v = value !== undefined ? value : this.getEmptyType(type);
       if (arraySize && type != 'char') {
         obj[name] = Array.from({ length: arraySize }, () => v);
@@ -327,11 +402,19 @@ class AsyncBufferAPI {
       fields = typeInfo.fields;
     }
     let view = new DataView(buffer);
-    let offset = 0;
     let obj = {}; //{ _structure: type };
-    fields.forEach(({ type, name, arraySize }) => {
+    this.#layoutFields(fields, ({ type, name, arraySize, bits }, offset, bitOffset) => {
       const typeInfo = this.getType(type);
-      if (arraySize) {
+      if (bits !== undefined) {
+        if (arraySize) {
+          obj[name] = [];
+          for (let i = 0; i < arraySize; i++) {
+            obj[name].push(this.#decodeClientType(type, this.#readBits(view, offset * 8 + i * bits, bits, typeInfo)));
+          }
+        } else {
+          obj[name] = this.#decodeClientType(type, this.#readBits(view, offset * 8 + bitOffset, bits, typeInfo));
+        }
+      } else if (arraySize) {
         obj[name] = [];
         for (let i = 0; i < arraySize; i++) {
           offset = this.#generateDecoding(buffer, view, offset, obj, type, name, true);
@@ -340,7 +423,7 @@ class AsyncBufferAPI {
           obj[name] = obj[name].join('');
         }
       } else {
-        offset = this.#generateDecoding(buffer, view, offset, obj, type, name);
+        this.#generateDecoding(buffer, view, offset, obj, type, name);
       }
     });
 
@@ -351,6 +434,17 @@ class AsyncBufferAPI {
 
     return obj;
   }
+  // decode a buffer of consecutive records into an array
+  decodeRecords(type, buffer) {
+    const typeInfo = this.getType(type);
+    const size = typeInfo.size || this.#calculateSize(typeInfo.fields);
+    const records = [];
+    for (let offset = 0; offset + size <= buffer.byteLength; offset += size) {
+      records.push(this.decode(typeInfo.id, buffer.slice(offset, offset + size)));
+    }
+    return records;
+  }
+
   // generateDecoding helper
   #generateDecoding(buffer, view, offset, obj, type, varName, isArray = false) {
     const typeInfo = this.getType(type);
@@ -396,14 +490,22 @@ class AsyncBufferAPI {
 
     let buffer = new ArrayBuffer(this.#calculateSize(fields));
     let view = new DataView(buffer);
-    let offset = 0;
-    fields.forEach(({ type, name, arraySize }) => { // body
-      if (arraySize) {
+    this.#layoutFields(fields, ({ type, name, arraySize, bits }, offset, bitOffset) => { // body
+      if (bits !== undefined) {
+        const typeInfo = this.getType(type);
+        if (arraySize) {
+          for (let i = 0; i < arraySize; i++) {
+            this.#writeBits(view, offset * 8 + i * bits, bits, typeInfo, this.#encodeClientType(type, data[name][i]));
+          }
+        } else {
+          this.#writeBits(view, offset * 8 + bitOffset, bits, typeInfo, this.#encodeClientType(type, data[name]));
+        }
+      } else if (arraySize) {
         for (let i = 0; i < arraySize; i++) {
           offset = this.#generateEncoding(buffer, view, offset, type, data[name][i], true);
         }
       } else {
-        offset = this.#generateEncoding(buffer, view, offset, type, data[name]);
+        this.#generateEncoding(buffer, view, offset, type, data[name]);
       }
     });
     return buffer;
@@ -464,10 +566,72 @@ class AsyncBufferAPI {
 
   // calculateSize struct size
   #calculateSize(fields = []) {
-    return fields.reduce((size, { type, arraySize }) => {
-      let typeSize = this.getType(type).size || this.#calculateSize(this.getType(type).fields);
-      return size + (arraySize ? typeSize * arraySize : typeSize);
-    }, 0);
+    return this.#layoutFields(fields);
+  }
+
+  // layoutFields walks the packed struct layout calling cb(field, byteOffset, bitOffset) for each named field.
+  // Bitfields follow gcc's packed little endian rules, consecutive bitfields share bytes starting from the
+  // least significant bit, any other field starts on the next whole byte and ':0' aligns to its type size.
+  #layoutFields(fields = [], cb = null) {
+    let offset = 0; // byte offset of the current field or bitfield run
+    let bitOffset = 0; // bits used in the current bitfield run
+    const closeRun = () => {
+      offset += Math.ceil(bitOffset / 8);
+      bitOffset = 0;
+    };
+    fields.forEach((field) => {
+      const { type, name, arraySize, bits } = field;
+      if (bits === undefined || arraySize) {
+        // whole byte field, packed bit arrays are byte aligned too
+        closeRun();
+        cb && name !== undefined && cb(field, offset, 0);
+        if (bits !== undefined) {
+          offset += Math.ceil((bits * arraySize) / 8);
+          return;
+        }
+        let typeSize = this.getType(type).size || this.#calculateSize(this.getType(type).fields);
+        offset += arraySize ? typeSize * arraySize : typeSize;
+        return;
+      }
+      if (bits === 0) {
+        // zero width bitfield aligns the next field to the declared type
+        const unitBits = this.getType(type).size * 8;
+        const position = offset * 8 + bitOffset;
+        offset = Math.ceil(position / unitBits) * unitBits / 8;
+        bitOffset = 0;
+        return;
+      }
+      cb && name !== undefined && cb(field, offset, bitOffset);
+      bitOffset += bits;
+    });
+    closeRun();
+    return offset;
+  }
+
+  // readBits little endian bit reader, bit 0 is the least significant bit of the first byte
+  #readBits(view, bitPosition, bits, typeInfo) {
+    let value = 0n;
+    for (let i = 0; i < bits; i++) {
+      const p = bitPosition + i;
+      if ((view.getUint8(p >> 3) >> (p & 7)) & 1) {
+        value |= 1n << BigInt(i);
+      }
+    }
+    if (/^get(Big)?Int/.test(typeInfo.readMethod) && value >> BigInt(bits - 1)) {
+      value -= 1n << BigInt(bits); // sign extend
+    }
+    return /Big/.test(typeInfo.readMethod) ? value : Number(value);
+  }
+
+  // writeBits little endian bit writer, values are truncated to integers and the bitfield width
+  #writeBits(view, bitPosition, bits, typeInfo, value = 0) {
+    value = BigInt.asUintN(bits, typeof value === "bigint" ? value : BigInt(Math.trunc(Number(value) || 0)));
+    for (let i = 0; i < bits; i++) {
+      const p = bitPosition + i;
+      const byte = view.getUint8(p >> 3);
+      const mask = 1 << (p & 7);
+      view.setUint8(p >> 3, (value >> BigInt(i)) & 1n ? byte | mask : byte & ~mask);
+    }
   }
 
   #computeChecksum(data) {
@@ -44,7 +44,8 @@ function extractBracedBlocks(input, startKeyword, endKeyword, removeChildBlocks
 }
 
 const structRegex = /struct\s+(\w+)/g;
-const variableRegex = /^\s*([\w\s:*&<>]+?)\s*(\w+)(?:\s*\[\s*(\d*)\s*\])?\s*?(:?\=[\d\w\s\[\]\.\{\}\"]*)?;/gm;
+const variableRegex = /^\s*((?:[\w\s*&<>]|::)+?)(?:\s*(?<=[\s*&>])(\w+))?(?:\s*\[\s*(\d*)\s*\])?(?:\s*:\s*(\d+))?\s*?(:?\=[\d\w\s\[\]\.\{\}\"]*)?;/gm;
+const packedBitsRegex = /^AsyncBufferBits\s*<\s*(\d+)\s*>$/;
 
 // Parse C++ struct definitions
 function parseStructs(content) {
@@ -70,11 +71,15 @@ function parseStructs(content) {
 
     let variables = [...body.matchAll(variableRegex)];
     variables.forEach(varMatch => {
-      let field = { type: varMatch[1], name: varMatch[2] };
+      let field = { type: varMatch[1].trim(), name: varMatch[2] };
       let arraySize = parseInt(varMatch[3] || 0);
+      let bits = varMatch[4];
+      if (field.name === undefined && bits === undefined) {
+        return; // not a member declaration
+      }
       let defaultValue = null;
       try {
-        defaultValueString = (varMatch[4] || "").replace('=', '').trim();
+        defaultValueString = (varMatch[5] || "").replace('=', '').trim();
         defaultValue = JSON.parse(defaultValueString);
         if(defaultValueString !== "{}") {
           field.value = defaultValue;
@@ -85,6 +90,34 @@ function parseStructs(content) {
       if(arraySize) {
         field.arraySize = arraySize;
       }
+      let packedBits = field.type.match(packedBitsRegex);
+      if(packedBits) {
+        // AsyncBufferBits<N> is a bool array packed 8 per byte
+        field.type = "bool";
+        field.arraySize = parseInt(packedBits[1]);
+        field.bits = 1;
+        if(arraySize) {
+          consoleOut.queue(`ERROR: UNSUPPORTED ARRAY '${structName}::${field.name}[${arraySize}]'\n  Arrays of AsyncBufferBits are not supported, use a single larger AsyncBufferBits<N>.`);
+        }
+      }
+      if(bits !== undefined) {
+        field.bits = parseInt(bits);
+        if(field.name !== undefined && bufferAPI.getType(`${field.type} ${field.name}`, false)) {
+          // unnamed bitfield with a multi word type 'unsigned int : 3;'
+          field.type = `${field.type} ${field.name}`;
+          field.name = undefined;
+        }
+        const typeInfo = bufferAPI.getType(field.type, false);
+        if (arraySize) {
+          consoleOut.queue(`ERROR: INVALID BITFIELD ARRAY '${structName}::${field.name}[${arraySize}] : ${bits}'\n  Arrays can't be bitfields, use AsyncBufferBits<N> for packed bool arrays.`);
+        }
+        else if (!typeInfo || !typeInfo.primitive || typeInfo.readMethod.indexOf("Float") != -1) {
+          consoleOut.queue(`ERROR: INVALID BITFIELD TYPE '${field.type}' in '${structName}::${field.name || ':' + bits}'\n  Bitfields must use an integer or bool type.`);
+        }
+        else if (field.bits > typeInfo.size * 8 || (field.bits === 0 && field.name !== undefined)) {
+          consoleOut.queue(`ERROR: INVALID BITFIELD WIDTH '${structName}::${field.name || ''} : ${bits}'\n  Width must be between 1 and ${typeInfo.size * 8} bits for '${field.type}', zero width bitfields must be unnamed.`);
+        }
+      }
       if(field.type.indexOf("*") != -1 || field.type.indexOf("&") != -1) {
         consoleOut.queue(`WARNING: POINTER USAGE '${structName}::*${field.name}'\n  Pointers can change during runtime and are not guaranteed to be the same between \n  requests or reboots. Not recommended to manipulate data.`);
         field.isPointer = true;